@@ -0,0 +1,462 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      main.c
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     SPSC Benchmark
+ *
+ *            This file is the SPSC benchmark sample. It measures the cost of
+ *            one operation on the lock-free SPSC paths and on the locked
+ *            paths they replace. The interrupts are locked while measuring,
+ *            so only the operations themselves are counted. The byte rings
+ *            are also compared streaming between two threads, which run on
+ *            different CPUs on SMP targets.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/ring_buffer.h>
+
+#include "zephyrMsgQueue.h"
+#include "zephyrSpscQueue.h"
+#include "zephyrSpscRingBuffer.h"
+
+/**
+ * @brief   The benchmark round count.
+ */
+#define BENCH_ROUNDS          1000
+
+/**
+ * @brief   The queue depth, filled then drained on each round.
+ */
+#define BENCH_QUEUE_DEPTH     64
+
+/**
+ * @brief   The queue message size.
+ */
+#define BENCH_MSG_SIZE        8
+
+/**
+ * @brief   The byte ring size.
+ */
+#define BENCH_RING_SIZE       1024
+
+/**
+ * @brief   The byte ring chunk size, BENCH_QUEUE_DEPTH chunks fill the ring.
+ */
+#define BENCH_CHUNK_SIZE      (BENCH_RING_SIZE / BENCH_QUEUE_DEPTH)
+
+/**
+ * @brief   The byte count streamed between the threads.
+ */
+#define BENCH_STREAM_SIZE     (256 * 1024)
+
+/**
+ * @brief   The producer thread stack size.
+ */
+#define BENCH_STACK_SIZE      1024
+
+/**
+ * @brief   The byte ring operation, a put or a get.
+ *
+ * @param data    The data.
+ * @param size    The data size.
+ *
+ * @return  The size put or got.
+ */
+typedef size_t (*BenchRingOp_t)(uint8_t *data, size_t size);
+
+/**
+ * @brief   The benchmarked byte ring.
+ */
+typedef struct
+{
+  const char *name;                 /**< The ring name. */
+  BenchRingOp_t put;                /**< The ring put. */
+  BenchRingOp_t get;                /**< The ring get. */
+} BenchRing_t;
+
+/**
+ * @brief   The benchmark result.
+ */
+typedef struct
+{
+  uint64_t putCycles;               /**< The total put cycles. */
+  uint64_t getCycles;               /**< The total get cycles. */
+  uint32_t opCount;                 /**< The put (and get) count. */
+} BenchResult_t;
+
+static ZEPHYR_MSG_QUEUE_BUFFER_DEFINE(msgqBuffer, BENCH_MSG_SIZE,
+                                      BENCH_QUEUE_DEPTH);
+static ZEPHYR_SPSC_QUEUE_BUFFER_DEFINE(spscBuffer, BENCH_MSG_SIZE,
+                                       BENCH_QUEUE_DEPTH);
+
+static uint8_t ringData[BENCH_RING_SIZE];
+static struct ring_buf ring;
+static struct k_spinlock ringLock;
+
+static ZEPHYR_SPSC_RING_BUF_DATA_DEFINE(spscRingData, BENCH_RING_SIZE);
+static ZephyrSpscRingBuffer_t spscRing;
+
+static K_THREAD_STACK_DEFINE(producerStack, BENCH_STACK_SIZE);
+static struct k_thread producerThread;
+
+/**
+ * @brief   Get the cycle counter, the 64 bits one when available. A round is
+ *          far shorter than the 32 bits counter period.
+ *
+ * @return  The cycle counter.
+ */
+static inline uint64_t benchCycles(void)
+{
+#ifdef CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER
+  return k_cycle_get_64();
+#else
+  return k_cycle_get_32();
+#endif
+}
+
+/**
+ * @brief   Get the cycles elapsed since a start.
+ *
+ * @param start   The start cycle counter.
+ *
+ * @return  The elapsed cycles.
+ */
+static inline uint32_t benchElapsed(uint64_t start)
+{
+  return (uint32_t)(benchCycles() - start);
+}
+
+/**
+ * @brief   Print a benchmark result.
+ *
+ * @param name    The benchmark name.
+ * @param result  The benchmark result.
+ */
+static void printResult(const char *name, BenchResult_t *result)
+{
+  printk("%-28s put %6u ns  get %6u ns\n", name,
+    (uint32_t)(k_cyc_to_ns_floor64(result->putCycles) / result->opCount),
+    (uint32_t)(k_cyc_to_ns_floor64(result->getCycles) / result->opCount));
+}
+
+/**
+ * @brief   Benchmark the message queue, going through k_msgq.
+ *
+ * @param result  The benchmark result.
+ */
+static void benchMsgQueue(BenchResult_t *result)
+{
+  unsigned int key;
+  uint64_t start;
+  ZephyrMsgQueue_t queue;
+  uint8_t msg[BENCH_MSG_SIZE] = {0};
+
+  zephyrMsgQueueInitStatic(&queue, msgqBuffer, BENCH_MSG_SIZE,
+    BENCH_QUEUE_DEPTH);
+
+  for(uint32_t round = 0; round < BENCH_ROUNDS; ++round)
+  {
+    key = irq_lock();
+
+    start = benchCycles();
+    for(uint32_t i = 0; i < BENCH_QUEUE_DEPTH; ++i)
+      zephyrMsgQueuePush(&queue, msg, ZEPHYR_TIME_NO_WAIT, MILLI_SEC);
+    result->putCycles += benchElapsed(start);
+
+    start = benchCycles();
+    for(uint32_t i = 0; i < BENCH_QUEUE_DEPTH; ++i)
+      zephyrMsgQueuePop(&queue, msg, ZEPHYR_TIME_NO_WAIT, MILLI_SEC);
+    result->getCycles += benchElapsed(start);
+
+    irq_unlock(key);
+  }
+
+  result->opCount = BENCH_ROUNDS * BENCH_QUEUE_DEPTH;
+}
+
+/**
+ * @brief   Benchmark the SPSC queue.
+ *
+ * @param result  The benchmark result.
+ * @param wakeup  The consumer wakeup policy.
+ */
+static void benchSpscQueue(BenchResult_t *result, ZephyrSpscWakeup_t wakeup)
+{
+  unsigned int key;
+  uint64_t start;
+  ZephyrSpscQueue_t queue;
+  uint8_t msg[BENCH_MSG_SIZE] = {0};
+
+  zephyrSpscQueueInitStatic(&queue, spscBuffer, BENCH_MSG_SIZE,
+    BENCH_QUEUE_DEPTH, wakeup);
+
+  for(uint32_t round = 0; round < BENCH_ROUNDS; ++round)
+  {
+    key = irq_lock();
+
+    start = benchCycles();
+    for(uint32_t i = 0; i < BENCH_QUEUE_DEPTH; ++i)
+      zephyrSpscQueuePush(&queue, msg);
+    result->putCycles += benchElapsed(start);
+
+    start = benchCycles();
+    for(uint32_t i = 0; i < BENCH_QUEUE_DEPTH; ++i)
+      zephyrSpscQueuePop(&queue, msg, ZEPHYR_TIME_NO_WAIT, MILLI_SEC);
+    result->getCycles += benchElapsed(start);
+
+    irq_unlock(key);
+  }
+
+  result->opCount = BENCH_ROUNDS * BENCH_QUEUE_DEPTH;
+}
+
+/**
+ * @brief   Put in the zephyr ring buffer.
+ *
+ * @param data    The data.
+ * @param size    The data size.
+ *
+ * @return  The size put.
+ */
+static size_t ringPut(uint8_t *data, size_t size)
+{
+  return ring_buf_put(&ring, data, size);
+}
+
+/**
+ * @brief   Get from the zephyr ring buffer.
+ *
+ * @param data    The output buffer.
+ * @param size    The output buffer size.
+ *
+ * @return  The size got.
+ */
+static size_t ringGet(uint8_t *data, size_t size)
+{
+  return ring_buf_get(&ring, data, size);
+}
+
+/**
+ * @brief   Put in the zephyr ring buffer under its lock, as concurrent
+ *          callers must.
+ *
+ * @param data    The data.
+ * @param size    The data size.
+ *
+ * @return  The size put.
+ */
+static size_t lockedRingPut(uint8_t *data, size_t size)
+{
+  size_t putSize;
+  k_spinlock_key_t key = k_spin_lock(&ringLock);
+
+  putSize = ring_buf_put(&ring, data, size);
+  k_spin_unlock(&ringLock, key);
+
+  return putSize;
+}
+
+/**
+ * @brief   Get from the zephyr ring buffer under its lock, as concurrent
+ *          callers must.
+ *
+ * @param data    The output buffer.
+ * @param size    The output buffer size.
+ *
+ * @return  The size got.
+ */
+static size_t lockedRingGet(uint8_t *data, size_t size)
+{
+  size_t getSize;
+  k_spinlock_key_t key = k_spin_lock(&ringLock);
+
+  getSize = ring_buf_get(&ring, data, size);
+  k_spin_unlock(&ringLock, key);
+
+  return getSize;
+}
+
+/**
+ * @brief   Put in the SPSC ring buffer.
+ *
+ * @param data    The data.
+ * @param size    The data size.
+ *
+ * @return  The size put.
+ */
+static size_t spscRingPut(uint8_t *data, size_t size)
+{
+  return zephyrSpscRingBufPut(&spscRing, data, size);
+}
+
+/**
+ * @brief   Get from the SPSC ring buffer.
+ *
+ * @param data    The output buffer.
+ * @param size    The output buffer size.
+ *
+ * @return  The size got.
+ */
+static size_t spscRingGet(uint8_t *data, size_t size)
+{
+  return zephyrSpscRingBufGet(&spscRing, data, size);
+}
+
+/**
+ * @brief   Reset the byte rings.
+ */
+static void resetRings(void)
+{
+  ring_buf_init(&ring, sizeof(ringData), ringData);
+  zephyrSpscRingBufInit(&spscRing, sizeof(spscRingData), spscRingData);
+}
+
+/**
+ * @brief   The benchmarked byte rings.
+ */
+static const BenchRing_t benchRings[] = {
+  {.name = "ring_buf", .put = ringPut, .get = ringGet},
+  {.name = "ring_buf (locked)", .put = lockedRingPut, .get = lockedRingGet},
+  {.name = "spsc ring", .put = spscRingPut, .get = spscRingGet},
+};
+
+/**
+ * @brief   Benchmark a byte ring, filling it then draining it by chunks.
+ *
+ * @param result  The benchmark result.
+ * @param bench   The byte ring.
+ */
+static void benchRing(BenchResult_t *result, const BenchRing_t *bench)
+{
+  unsigned int key;
+  uint64_t start;
+  uint8_t chunk[BENCH_CHUNK_SIZE] = {0};
+
+  resetRings();
+
+  for(uint32_t round = 0; round < BENCH_ROUNDS; ++round)
+  {
+    key = irq_lock();
+
+    start = benchCycles();
+    for(uint32_t i = 0; i < BENCH_QUEUE_DEPTH; ++i)
+      bench->put(chunk, sizeof(chunk));
+    result->putCycles += benchElapsed(start);
+
+    start = benchCycles();
+    for(uint32_t i = 0; i < BENCH_QUEUE_DEPTH; ++i)
+      bench->get(chunk, sizeof(chunk));
+    result->getCycles += benchElapsed(start);
+
+    irq_unlock(key);
+  }
+
+  result->opCount = BENCH_ROUNDS * BENCH_QUEUE_DEPTH;
+}
+
+/**
+ * @brief   The stream producer thread, putting BENCH_STREAM_SIZE bytes.
+ *
+ * @param p1      The byte ring.
+ * @param p2      Unused.
+ * @param p3      Unused.
+ */
+static void streamProducer(void *p1, void *p2, void *p3)
+{
+  const BenchRing_t *bench = p1;
+  uint8_t chunk[BENCH_CHUNK_SIZE];
+  size_t putSize;
+
+  for(size_t sent = 0; sent < BENCH_STREAM_SIZE; sent += putSize)
+  {
+    for(size_t i = 0; i < sizeof(chunk); ++i)
+      chunk[i] = (uint8_t)(sent + i);
+
+    putSize = bench->put(chunk, MIN(sizeof(chunk), BENCH_STREAM_SIZE - sent));
+    if(putSize == 0)
+      k_yield();
+  }
+}
+
+/**
+ * @brief   Benchmark a byte ring streaming from a producer thread to the
+ *          current thread, checking the data.
+ *
+ * @param bench   The byte ring.
+ */
+static void benchRingStream(const BenchRing_t *bench)
+{
+  int64_t start;
+  uint64_t elapsedUs;
+  size_t getSize;
+  size_t errorCnt = 0;
+  uint8_t chunk[BENCH_CHUNK_SIZE];
+
+  resetRings();
+
+  start = k_uptime_ticks();
+  k_thread_create(&producerThread, producerStack,
+    K_THREAD_STACK_SIZEOF(producerStack), streamProducer, (void *)bench, NULL, NULL,
+    k_thread_priority_get(k_current_get()), 0, K_NO_WAIT);
+
+  for(size_t got = 0; got < BENCH_STREAM_SIZE; got += getSize)
+  {
+    getSize = bench->get(chunk, sizeof(chunk));
+    if(getSize == 0)
+      k_yield();
+
+    for(size_t i = 0; i < getSize; ++i)
+      errorCnt += chunk[i] != (uint8_t)(got + i);
+  }
+
+  k_thread_join(&producerThread, K_FOREVER);
+  elapsedUs = MAX(k_ticks_to_us_floor64(k_uptime_ticks() - start), 1);
+
+  printk("%-28s %6u KB/s%s\n", bench->name,
+    (uint32_t)((uint64_t)BENCH_STREAM_SIZE * 1000 / 1024 * 1000 / elapsedUs),
+    errorCnt > 0 ? "  DATA ERROR" : "");
+}
+
+int main(void)
+{
+  BenchResult_t result;
+
+  printk("SPSC benchmark on %s, %u rounds of %u operations\n", CONFIG_BOARD,
+    BENCH_ROUNDS, BENCH_QUEUE_DEPTH);
+
+  memset(&result, 0, sizeof(result));
+  benchMsgQueue(&result);
+  printResult("msgq", &result);
+
+  memset(&result, 0, sizeof(result));
+  benchSpscQueue(&result, SPSC_WAKEUP_NONE);
+  printResult("spsc queue (no wakeup)", &result);
+
+  memset(&result, 0, sizeof(result));
+  benchSpscQueue(&result, SPSC_WAKEUP_ON_EMPTY);
+  printResult("spsc queue (wakeup on empty)", &result);
+
+  for(size_t i = 0; i < ARRAY_SIZE(benchRings); ++i)
+  {
+    memset(&result, 0, sizeof(result));
+    benchRing(&result, benchRings + i);
+    printResult(benchRings[i].name, &result);
+  }
+
+  /* the bare zephyr ring is not safe for concurrent callers. */
+  printk("streaming %u KB between 2 threads on %u CPU(s)\n",
+    BENCH_STREAM_SIZE / 1024, arch_num_cpus());
+  for(size_t i = 1; i < ARRAY_SIZE(benchRings); ++i)
+    benchRingStream(benchRings + i);
+
+  return 0;
+}
+
+/** @} */
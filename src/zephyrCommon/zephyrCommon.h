@@ -20,6 +20,10 @@
 
 #include <zephyr/kernel.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /**
  * @brief   The zephyr wrapper module name.
 */
@@ -68,6 +72,10 @@ typedef enum
  */
 k_timeout_t zephyrCommonProcessTimeout(uint32_t time, ZephyrTimeUnit_t unit);
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif    /* COMMON_WRAPPER */
 
 /** @} */
@@ -0,0 +1,242 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrLedAnimation.c
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     LED Animation Wrapper
+ *
+ *            This file is the implementation of the LED strip animation
+ *            player.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#include <string.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include "zephyrLedAnimation.h"
+#include "zephyrCommon.h"
+
+LOG_MODULE_DECLARE(ZEPHYR_WRAPPER_MODULE_NAME);
+
+/**
+ * @brief   The RGB triplet size in bytes.
+*/
+#define TRIPLET_SIZE                  3
+
+/**
+ * @brief   Get the payload size of a frame operation.
+ *
+ * @param op        The operation.
+ * @param pixelCnt  The pixel count of the operation.
+ *
+ * @return          The payload size in bytes.
+ */
+static inline size_t getPayloadSize(ZephyrLedAnimOp_t op, uint32_t pixelCnt)
+{
+  if(op == LED_ANIM_OP_SKIP)
+    return 0;
+  if(op == LED_ANIM_OP_FILL)
+    return TRIPLET_SIZE;
+  return pixelCnt * TRIPLET_SIZE;
+}
+
+/**
+ * @brief   Check the next frame as a whole before decoding it.
+ *
+ * @param anim      The animation player.
+ *
+ * @return          0 if successful, -EBADMSG if the frame is truncated,
+ *                  corrupted or a keyframe using a delta operation.
+ */
+static int checkFrame(ZephyrLedAnimation_t *anim)
+{
+  uint32_t pixelIdx = 0;
+  uint32_t pixelCnt;
+  size_t offset = anim->offset;
+  size_t payloadSize;
+  ZephyrLedAnimOp_t op;
+
+  while(pixelIdx < anim->pixelCount)
+  {
+    if(offset >= anim->size)
+    {
+      LOG_ERR("truncated LED animation frame %d", anim->frameIdx);
+      return -EBADMSG;
+    }
+
+    op = anim->data[offset] >> 6;
+    pixelCnt = (anim->data[offset] & 0x3f) + 1;
+    payloadSize = getPayloadSize(op, pixelCnt);
+    ++offset;
+
+    if(pixelCnt > anim->pixelCount - pixelIdx ||
+       payloadSize > anim->size - offset)
+    {
+      LOG_ERR("corrupted LED animation frame %d", anim->frameIdx);
+      return -EBADMSG;
+    }
+
+    /* the keyframe has no previous frame to apply a delta to. */
+    if(anim->frameIdx == 0 &&
+       (op == LED_ANIM_OP_SKIP || op == LED_ANIM_OP_XOR))
+    {
+      LOG_ERR("delta operation in the LED animation keyframe");
+      return -EBADMSG;
+    }
+
+    pixelIdx += pixelCnt;
+    offset += payloadSize;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief   Decode one frame operation in the reference frame.
+ *
+ * @param anim      The animation player.
+ * @param pixelIdx  The first pixel of the operation.
+ * @param op        The operation.
+ * @param pixelCnt  The pixel count of the operation.
+ * @param payload   The operation payload.
+ */
+static void decodeOp(ZephyrLedAnimation_t *anim, uint32_t pixelIdx,
+                     ZephyrLedAnimOp_t op, uint32_t pixelCnt,
+                     const uint8_t *payload)
+{
+  ZephyrRgbPixel_t *pixel = anim->frame + pixelIdx;
+  ZephyrRgbPixel_t *end = pixel + pixelCnt;
+
+  switch(op)
+  {
+    case LED_ANIM_OP_RAW:
+      for(; pixel < end; ++pixel, payload += TRIPLET_SIZE)
+      {
+        pixel->r = payload[0];
+        pixel->g = payload[1];
+        pixel->b = payload[2];
+      }
+      break;
+    case LED_ANIM_OP_FILL:
+      for(; pixel < end; ++pixel)
+      {
+        pixel->r = payload[0];
+        pixel->g = payload[1];
+        pixel->b = payload[2];
+      }
+      break;
+    case LED_ANIM_OP_XOR:
+      for(; pixel < end; ++pixel, payload += TRIPLET_SIZE)
+      {
+        pixel->r ^= payload[0];
+        pixel->g ^= payload[1];
+        pixel->b ^= payload[2];
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+int zephyrLedAnimationInit(ZephyrLedAnimation_t *anim, ZephyrLedStrip_t *strip,
+                           const uint8_t *data, size_t size, bool loop)
+{
+  if(!strip->dev || !strip->rgbPixels)
+  {
+    LOG_ERR("LED strip not yet initialized");
+    return -ENODEV;
+  }
+
+  if(size < LED_ANIM_HEADER_SIZE || data[0] != 'L' || data[1] != 'A')
+  {
+    LOG_ERR("invalid LED animation header");
+    return -EINVAL;
+  }
+
+  anim->pixelCount = sys_get_le16(data + 2);
+  anim->frameCount = sys_get_le16(data + 4);
+  anim->frameDelay = sys_get_le16(data + 6);
+
+  if(anim->pixelCount == 0 || anim->pixelCount > strip->pixelCount)
+  {
+    LOG_ERR("the animation pixel count (%d) is out of range (%d)",
+      anim->pixelCount, strip->pixelCount);
+    return -EDOM;
+  }
+
+  anim->frame = k_malloc(anim->pixelCount * sizeof(ZephyrRgbPixel_t));
+  if(!anim->frame)
+  {
+    LOG_ERR("unable to allocate memory for %d X RGB pixel", anim->pixelCount);
+    return -ENOSPC;
+  }
+  memset(anim->frame, 0x00, anim->pixelCount * sizeof(ZephyrRgbPixel_t));
+
+  anim->strip = strip;
+  anim->data = data;
+  anim->size = size;
+  anim->loop = loop;
+  zephyrLedAnimationRewind(anim);
+
+  return 0;
+}
+
+uint16_t zephyrLedAnimationGetFrameDelay(ZephyrLedAnimation_t *anim)
+{
+  return anim->frameDelay;
+}
+
+void zephyrLedAnimationRewind(ZephyrLedAnimation_t *anim)
+{
+  anim->frameIdx = 0;
+  anim->offset = LED_ANIM_HEADER_SIZE;
+}
+
+int zephyrLedAnimationNextFrame(ZephyrLedAnimation_t *anim)
+{
+  int rc;
+  uint32_t pixelIdx = 0;
+  uint32_t pixelCnt;
+  size_t offset;
+  ZephyrLedAnimOp_t op;
+
+  if(anim->frameIdx >= anim->frameCount)
+  {
+    if(!anim->loop || anim->frameCount == 0)
+      return -ENODATA;
+
+    zephyrLedAnimationRewind(anim);
+  }
+
+  rc = checkFrame(anim);
+  if(rc < 0)
+    return rc;
+
+  offset = anim->offset;
+  while(pixelIdx < anim->pixelCount)
+  {
+    op = anim->data[offset] >> 6;
+    pixelCnt = (anim->data[offset] & 0x3f) + 1;
+    ++offset;
+
+    decodeOp(anim, pixelIdx, op, pixelCnt, anim->data + offset);
+    pixelIdx += pixelCnt;
+    offset += getPayloadSize(op, pixelCnt);
+  }
+
+  /* the whole frame is stored, the strip storage may not hold the last. */
+  for(pixelIdx = 0; pixelIdx < anim->pixelCount; ++pixelIdx)
+    zephyrLedStripStorePixel(anim->strip, pixelIdx, anim->frame + pixelIdx);
+
+  anim->offset = offset;
+  ++anim->frameIdx;
+
+  return 0;
+}
+
+/** @} */
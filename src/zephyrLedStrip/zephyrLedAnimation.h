@@ -0,0 +1,133 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrLedAnimation.h
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     LED Animation Wrapper
+ *
+ *            This file is the declaration of the LED strip animation player.
+ *            The animations are decoded frame by frame from a read-only
+ *            (usually memory-mapped flash) buffer. The player keeps its read
+ *            position and an 8 bits reference frame in RAM, the deltas being
+ *            applied to this frame since the strip storage can be lossy or
+ *            overwritten by the driver. Each decoded frame is then stored in
+ *            the strip pixels.
+ *
+ *            The animation format is (multi-byte values are little-endian):
+ *            - header: 'L', 'A', pixel count (u16), frame count (u16),
+ *              frame delay in ms (u16).
+ *            - frames: a sequence of operations covering exactly the pixel
+ *              count. Each operation starts with one byte, the 2 MSBs being
+ *              the operation and the 6 LSBs the pixel count minus one:
+ *              - LED_ANIM_OP_SKIP: the pixels are unchanged, no payload.
+ *              - LED_ANIM_OP_RAW: one RGB triplet per pixel.
+ *              - LED_ANIM_OP_FILL: one RGB triplet for all the pixels.
+ *              - LED_ANIM_OP_XOR: one RGB triplet per pixel, XORed on the
+ *                current pixel.
+ *            The first frame is the keyframe and must only use the raw and
+ *            fill operations. A frame is checked as a whole before being
+ *            decoded, so a corrupted frame leaves the pixels untouched.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#ifndef LED_ANIMATION_WRAPPER
+#define LED_ANIMATION_WRAPPER
+
+#include <zephyr/kernel.h>
+
+#include "zephyrLedStrip.h"
+
+/**
+ * @brief   The animation header size in bytes.
+*/
+#define LED_ANIM_HEADER_SIZE          8
+
+/**
+ * @brief   The maximum pixel count of a single operation.
+*/
+#define LED_ANIM_OP_MAX_PIXELS        64
+
+/**
+ * @brief   The animation operation byte constructor.
+*/
+#define LED_ANIM_OP(_op, _pixelCnt)   ((uint8_t)(((_op) << 6) | ((_pixelCnt) - 1)))
+
+/**
+ * @brief   The animation frame operations.
+*/
+typedef enum
+{
+  LED_ANIM_OP_SKIP,                 /**< The unchanged pixels operation. */
+  LED_ANIM_OP_RAW,                  /**< The raw pixels operation. */
+  LED_ANIM_OP_FILL,                 /**< The run-length fill operation. */
+  LED_ANIM_OP_XOR,                  /**< The XOR delta operation. */
+} ZephyrLedAnimOp_t;
+
+/**
+ * @brief   The LED animation player data structure.
+*/
+typedef struct
+{
+  ZephyrLedStrip_t *strip;          /**< The LED strip to play on. */
+  const uint8_t *data;              /**< The encoded animation. */
+  size_t size;                      /**< The encoded animation size. */
+  uint16_t pixelCount;              /**< The animation pixel count. */
+  uint16_t frameCount;              /**< The animation frame count. */
+  uint16_t frameDelay;              /**< The frame delay in ms. */
+  uint16_t frameIdx;                /**< The next frame index. */
+  ZephyrRgbPixel_t *frame;          /**< The reference frame. */
+  size_t offset;                    /**< The next frame offset in the data. */
+  bool loop;                        /**< The looping flag. */
+} ZephyrLedAnimation_t;
+
+/**
+ * @brief   Initialize an animation player. The reference frame is allocated
+ *          on the heap.
+ *
+ * @param anim      The animation player to initialize.
+ * @param strip     The LED strip to play on.
+ * @param data      The encoded animation.
+ * @param size      The encoded animation size.
+ * @param loop      The looping flag, the animation restarts at the keyframe
+ *                  after the last frame if set.
+ *
+ * @return          0 if successful, the error code otherwise.
+ */
+int zephyrLedAnimationInit(ZephyrLedAnimation_t *anim, ZephyrLedStrip_t *strip,
+                           const uint8_t *data, size_t size, bool loop);
+
+/**
+ * @brief   Get the animation frame delay.
+ *
+ * @param anim      The animation player.
+ *
+ * @return          The frame delay in ms.
+ */
+uint16_t zephyrLedAnimationGetFrameDelay(ZephyrLedAnimation_t *anim);
+
+/**
+ * @brief   Rewind the animation to its keyframe.
+ *
+ * @param anim      The animation player.
+ */
+void zephyrLedAnimationRewind(ZephyrLedAnimation_t *anim);
+
+/**
+ * @brief   Decode the next animation frame in the reference frame and store
+ *          it in the strip pixels. The strip still needs to be updated to
+ *          show the frame.
+ *
+ * @param anim      The animation player.
+ *
+ * @return          0 if successful, -ENODATA at the end of a non-looping
+ *                  animation, -EBADMSG if the frame is corrupted, the error
+ *                  code otherwise.
+ */
+int zephyrLedAnimationNextFrame(ZephyrLedAnimation_t *anim);
+
+#endif    /* LED_ANIMATION_WRAPPER */
+
+/** @} */
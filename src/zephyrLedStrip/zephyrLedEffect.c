@@ -0,0 +1,434 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrLedEffect.c
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     LED Effect Wrapper
+ *
+ *            This file is the implementation of the LED strip effects.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+#include "zephyrLedEffect.h"
+#include "zephyrCommon.h"
+
+LOG_MODULE_DECLARE(ZEPHYR_WRAPPER_MODULE_NAME);
+
+/**
+ * @brief   The fixed-point end of the 0 to 255 interpolation range.
+*/
+#define FRACTION_END                  (255U << 8)
+
+/**
+ * @brief   The fixed-point end of the full color wheel/sine turn.
+*/
+#define TURN_END                      (256U << 8)
+
+/**
+ * @brief   The sine table, one full turn over 256 entries scaled from
+ *          0 to 255.
+*/
+static const uint8_t sineTable[256] = {
+  0x80, 0x83, 0x86, 0x89, 0x8c, 0x8f, 0x92, 0x95, 0x98, 0x9b, 0x9e, 0xa2,
+  0xa5, 0xa7, 0xaa, 0xad, 0xb0, 0xb3, 0xb6, 0xb9, 0xbc, 0xbe, 0xc1, 0xc4,
+  0xc6, 0xc9, 0xcb, 0xce, 0xd0, 0xd3, 0xd5, 0xd7, 0xda, 0xdc, 0xde, 0xe0,
+  0xe2, 0xe4, 0xe6, 0xe8, 0xea, 0xeb, 0xed, 0xee, 0xf0, 0xf1, 0xf3, 0xf4,
+  0xf5, 0xf6, 0xf8, 0xf9, 0xfa, 0xfa, 0xfb, 0xfc, 0xfd, 0xfd, 0xfe, 0xfe,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfd,
+  0xfd, 0xfc, 0xfb, 0xfa, 0xfa, 0xf9, 0xf8, 0xf6, 0xf5, 0xf4, 0xf3, 0xf1,
+  0xf0, 0xee, 0xed, 0xeb, 0xea, 0xe8, 0xe6, 0xe4, 0xe2, 0xe0, 0xde, 0xdc,
+  0xda, 0xd7, 0xd5, 0xd3, 0xd0, 0xce, 0xcb, 0xc9, 0xc6, 0xc4, 0xc1, 0xbe,
+  0xbc, 0xb9, 0xb6, 0xb3, 0xb0, 0xad, 0xaa, 0xa7, 0xa5, 0xa2, 0x9e, 0x9b,
+  0x98, 0x95, 0x92, 0x8f, 0x8c, 0x89, 0x86, 0x83, 0x80, 0x7c, 0x79, 0x76,
+  0x73, 0x70, 0x6d, 0x6a, 0x67, 0x64, 0x61, 0x5d, 0x5a, 0x58, 0x55, 0x52,
+  0x4f, 0x4c, 0x49, 0x46, 0x43, 0x41, 0x3e, 0x3b, 0x39, 0x36, 0x34, 0x31,
+  0x2f, 0x2c, 0x2a, 0x28, 0x25, 0x23, 0x21, 0x1f, 0x1d, 0x1b, 0x19, 0x17,
+  0x15, 0x14, 0x12, 0x11, 0x0f, 0x0e, 0x0c, 0x0b, 0x0a, 0x09, 0x07, 0x06,
+  0x05, 0x05, 0x04, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05,
+  0x05, 0x06, 0x07, 0x09, 0x0a, 0x0b, 0x0c, 0x0e, 0x0f, 0x11, 0x12, 0x14,
+  0x15, 0x17, 0x19, 0x1b, 0x1d, 0x1f, 0x21, 0x23, 0x25, 0x28, 0x2a, 0x2c,
+  0x2f, 0x31, 0x34, 0x36, 0x39, 0x3b, 0x3e, 0x41, 0x43, 0x46, 0x49, 0x4c,
+  0x4f, 0x52, 0x55, 0x58, 0x5a, 0x5d, 0x61, 0x64, 0x67, 0x6a, 0x6d, 0x70,
+  0x73, 0x76, 0x79, 0x7c,
+};
+
+/**
+ * @brief   The color wheel table, one full turn of fully saturated hues over
+ *          256 entries. This is the output of zephyrLedEffectHsvToRgb()
+ *          with full saturation and value.
+*/
+static const uint8_t colorWheel[256][3] = {
+  {0xff, 0x00, 0x00}, {0xff, 0x06, 0x00}, {0xff, 0x0c, 0x00}, {0xff, 0x12, 0x00},
+  {0xff, 0x18, 0x00}, {0xff, 0x1e, 0x00}, {0xff, 0x24, 0x00}, {0xff, 0x2a, 0x00},
+  {0xff, 0x30, 0x00}, {0xff, 0x36, 0x00}, {0xff, 0x3c, 0x00}, {0xff, 0x42, 0x00},
+  {0xff, 0x48, 0x00}, {0xff, 0x4e, 0x00}, {0xff, 0x54, 0x00}, {0xff, 0x5a, 0x00},
+  {0xff, 0x60, 0x00}, {0xff, 0x66, 0x00}, {0xff, 0x6c, 0x00}, {0xff, 0x72, 0x00},
+  {0xff, 0x78, 0x00}, {0xff, 0x7e, 0x00}, {0xff, 0x84, 0x00}, {0xff, 0x8a, 0x00},
+  {0xff, 0x90, 0x00}, {0xff, 0x96, 0x00}, {0xff, 0x9c, 0x00}, {0xff, 0xa2, 0x00},
+  {0xff, 0xa8, 0x00}, {0xff, 0xae, 0x00}, {0xff, 0xb4, 0x00}, {0xff, 0xba, 0x00},
+  {0xff, 0xc0, 0x00}, {0xff, 0xc6, 0x00}, {0xff, 0xcc, 0x00}, {0xff, 0xd2, 0x00},
+  {0xff, 0xd8, 0x00}, {0xff, 0xde, 0x00}, {0xff, 0xe4, 0x00}, {0xff, 0xea, 0x00},
+  {0xff, 0xf0, 0x00}, {0xff, 0xf6, 0x00}, {0xff, 0xfc, 0x00}, {0xfd, 0xff, 0x00},
+  {0xf7, 0xff, 0x00}, {0xf1, 0xff, 0x00}, {0xeb, 0xff, 0x00}, {0xe5, 0xff, 0x00},
+  {0xdf, 0xff, 0x00}, {0xd9, 0xff, 0x00}, {0xd3, 0xff, 0x00}, {0xcd, 0xff, 0x00},
+  {0xc7, 0xff, 0x00}, {0xc1, 0xff, 0x00}, {0xbb, 0xff, 0x00}, {0xb5, 0xff, 0x00},
+  {0xaf, 0xff, 0x00}, {0xa9, 0xff, 0x00}, {0xa3, 0xff, 0x00}, {0x9d, 0xff, 0x00},
+  {0x97, 0xff, 0x00}, {0x91, 0xff, 0x00}, {0x8b, 0xff, 0x00}, {0x85, 0xff, 0x00},
+  {0x7f, 0xff, 0x00}, {0x79, 0xff, 0x00}, {0x73, 0xff, 0x00}, {0x6d, 0xff, 0x00},
+  {0x67, 0xff, 0x00}, {0x61, 0xff, 0x00}, {0x5b, 0xff, 0x00}, {0x55, 0xff, 0x00},
+  {0x4f, 0xff, 0x00}, {0x49, 0xff, 0x00}, {0x43, 0xff, 0x00}, {0x3d, 0xff, 0x00},
+  {0x37, 0xff, 0x00}, {0x31, 0xff, 0x00}, {0x2b, 0xff, 0x00}, {0x25, 0xff, 0x00},
+  {0x1f, 0xff, 0x00}, {0x19, 0xff, 0x00}, {0x13, 0xff, 0x00}, {0x0d, 0xff, 0x00},
+  {0x07, 0xff, 0x00}, {0x01, 0xff, 0x00}, {0x00, 0xff, 0x04}, {0x00, 0xff, 0x0a},
+  {0x00, 0xff, 0x10}, {0x00, 0xff, 0x16}, {0x00, 0xff, 0x1c}, {0x00, 0xff, 0x22},
+  {0x00, 0xff, 0x28}, {0x00, 0xff, 0x2e}, {0x00, 0xff, 0x34}, {0x00, 0xff, 0x3a},
+  {0x00, 0xff, 0x40}, {0x00, 0xff, 0x46}, {0x00, 0xff, 0x4c}, {0x00, 0xff, 0x52},
+  {0x00, 0xff, 0x58}, {0x00, 0xff, 0x5e}, {0x00, 0xff, 0x64}, {0x00, 0xff, 0x6a},
+  {0x00, 0xff, 0x70}, {0x00, 0xff, 0x76}, {0x00, 0xff, 0x7c}, {0x00, 0xff, 0x82},
+  {0x00, 0xff, 0x88}, {0x00, 0xff, 0x8e}, {0x00, 0xff, 0x94}, {0x00, 0xff, 0x9a},
+  {0x00, 0xff, 0xa0}, {0x00, 0xff, 0xa6}, {0x00, 0xff, 0xac}, {0x00, 0xff, 0xb2},
+  {0x00, 0xff, 0xb8}, {0x00, 0xff, 0xbe}, {0x00, 0xff, 0xc4}, {0x00, 0xff, 0xca},
+  {0x00, 0xff, 0xd0}, {0x00, 0xff, 0xd6}, {0x00, 0xff, 0xdc}, {0x00, 0xff, 0xe2},
+  {0x00, 0xff, 0xe8}, {0x00, 0xff, 0xee}, {0x00, 0xff, 0xf4}, {0x00, 0xff, 0xfa},
+  {0x00, 0xfe, 0xff}, {0x00, 0xf9, 0xff}, {0x00, 0xf3, 0xff}, {0x00, 0xed, 0xff},
+  {0x00, 0xe7, 0xff}, {0x00, 0xe1, 0xff}, {0x00, 0xdb, 0xff}, {0x00, 0xd5, 0xff},
+  {0x00, 0xcf, 0xff}, {0x00, 0xc9, 0xff}, {0x00, 0xc3, 0xff}, {0x00, 0xbd, 0xff},
+  {0x00, 0xb7, 0xff}, {0x00, 0xb1, 0xff}, {0x00, 0xab, 0xff}, {0x00, 0xa5, 0xff},
+  {0x00, 0x9f, 0xff}, {0x00, 0x99, 0xff}, {0x00, 0x93, 0xff}, {0x00, 0x8d, 0xff},
+  {0x00, 0x87, 0xff}, {0x00, 0x81, 0xff}, {0x00, 0x7b, 0xff}, {0x00, 0x75, 0xff},
+  {0x00, 0x6f, 0xff}, {0x00, 0x69, 0xff}, {0x00, 0x63, 0xff}, {0x00, 0x5d, 0xff},
+  {0x00, 0x57, 0xff}, {0x00, 0x51, 0xff}, {0x00, 0x4b, 0xff}, {0x00, 0x45, 0xff},
+  {0x00, 0x3f, 0xff}, {0x00, 0x39, 0xff}, {0x00, 0x33, 0xff}, {0x00, 0x2d, 0xff},
+  {0x00, 0x27, 0xff}, {0x00, 0x21, 0xff}, {0x00, 0x1b, 0xff}, {0x00, 0x15, 0xff},
+  {0x00, 0x0f, 0xff}, {0x00, 0x09, 0xff}, {0x00, 0x03, 0xff}, {0x02, 0x00, 0xff},
+  {0x08, 0x00, 0xff}, {0x0e, 0x00, 0xff}, {0x14, 0x00, 0xff}, {0x1a, 0x00, 0xff},
+  {0x20, 0x00, 0xff}, {0x26, 0x00, 0xff}, {0x2c, 0x00, 0xff}, {0x32, 0x00, 0xff},
+  {0x38, 0x00, 0xff}, {0x3e, 0x00, 0xff}, {0x44, 0x00, 0xff}, {0x4a, 0x00, 0xff},
+  {0x50, 0x00, 0xff}, {0x56, 0x00, 0xff}, {0x5c, 0x00, 0xff}, {0x62, 0x00, 0xff},
+  {0x68, 0x00, 0xff}, {0x6e, 0x00, 0xff}, {0x74, 0x00, 0xff}, {0x7a, 0x00, 0xff},
+  {0x80, 0x00, 0xff}, {0x86, 0x00, 0xff}, {0x8c, 0x00, 0xff}, {0x92, 0x00, 0xff},
+  {0x98, 0x00, 0xff}, {0x9e, 0x00, 0xff}, {0xa4, 0x00, 0xff}, {0xaa, 0x00, 0xff},
+  {0xb0, 0x00, 0xff}, {0xb6, 0x00, 0xff}, {0xbc, 0x00, 0xff}, {0xc2, 0x00, 0xff},
+  {0xc8, 0x00, 0xff}, {0xce, 0x00, 0xff}, {0xd4, 0x00, 0xff}, {0xda, 0x00, 0xff},
+  {0xe0, 0x00, 0xff}, {0xe6, 0x00, 0xff}, {0xec, 0x00, 0xff}, {0xf2, 0x00, 0xff},
+  {0xf8, 0x00, 0xff}, {0xfe, 0x00, 0xff}, {0xff, 0x00, 0xfb}, {0xff, 0x00, 0xf5},
+  {0xff, 0x00, 0xef}, {0xff, 0x00, 0xe9}, {0xff, 0x00, 0xe3}, {0xff, 0x00, 0xdd},
+  {0xff, 0x00, 0xd7}, {0xff, 0x00, 0xd1}, {0xff, 0x00, 0xcb}, {0xff, 0x00, 0xc5},
+  {0xff, 0x00, 0xbf}, {0xff, 0x00, 0xb9}, {0xff, 0x00, 0xb3}, {0xff, 0x00, 0xad},
+  {0xff, 0x00, 0xa7}, {0xff, 0x00, 0xa1}, {0xff, 0x00, 0x9b}, {0xff, 0x00, 0x95},
+  {0xff, 0x00, 0x8f}, {0xff, 0x00, 0x89}, {0xff, 0x00, 0x83}, {0xff, 0x00, 0x7d},
+  {0xff, 0x00, 0x77}, {0xff, 0x00, 0x71}, {0xff, 0x00, 0x6b}, {0xff, 0x00, 0x65},
+  {0xff, 0x00, 0x5f}, {0xff, 0x00, 0x59}, {0xff, 0x00, 0x53}, {0xff, 0x00, 0x4d},
+  {0xff, 0x00, 0x47}, {0xff, 0x00, 0x41}, {0xff, 0x00, 0x3b}, {0xff, 0x00, 0x35},
+  {0xff, 0x00, 0x2f}, {0xff, 0x00, 0x29}, {0xff, 0x00, 0x23}, {0xff, 0x00, 0x1d},
+  {0xff, 0x00, 0x17}, {0xff, 0x00, 0x11}, {0xff, 0x00, 0x0b}, {0xff, 0x00, 0x05},
+};
+
+/**
+ * @brief   Update the cached per-pixel step of an effect if the rendered
+ *          span changed. This is the only division of the rendering and it
+ *          only runs when the span changes.
+ *
+ * @param effect    The effect.
+ * @param steps     The step count over the span.
+ * @param range     The fixed-point range to cover over the span.
+ */
+static void updateSpanStep(ZephyrLedEffect_t *effect, uint32_t steps,
+                           uint32_t range)
+{
+  if(effect->spanCount == steps)
+    return;
+
+  effect->spanCount = steps;
+  effect->spanStep = steps > 0 ? range / steps : 0;
+}
+
+/**
+ * @brief   Render one frame of an effect over a pixel span.
+ *
+ * @param effect    The effect.
+ * @param strip     The LED strip.
+ * @param pixelIdx  The strip index of the first pixel of the span.
+ * @param count     The pixel count of the span.
+ * @param stride    The index stride between two consecutive span pixels.
+ */
+static void renderSpan(ZephyrLedEffect_t *effect, ZephyrLedStrip_t *strip,
+                       uint32_t pixelIdx, uint32_t count, int32_t stride)
+{
+  ZephyrRgbPixel_t color;
+  uint32_t pos;
+  uint32_t chaseCnt;
+
+  switch(effect->type)
+  {
+    case LED_EFFECT_FILL:
+      color = effect->colorA;
+      break;
+    case LED_EFFECT_FADE:
+      zephyrLedEffectBlend(&effect->colorA, &effect->colorB,
+        effect->phase >> 8, &color);
+      break;
+    case LED_EFFECT_BREATHE:
+      zephyrLedEffectScale(&effect->colorA, sineTable[(effect->phase >> 8) & 0xff],
+        &color);
+      break;
+    case LED_EFFECT_GRADIENT:
+      updateSpanStep(effect, count > 0 ? count - 1 : 0, FRACTION_END);
+      for(pos = 0; count > 0;
+          --count, pos += effect->spanStep, pixelIdx += stride)
+      {
+        zephyrLedEffectBlend(&effect->colorA, &effect->colorB, pos >> 8, &color);
+        zephyrLedStripStorePixel(strip, pixelIdx, &color);
+      }
+      return;
+    case LED_EFFECT_RAINBOW:
+      updateSpanStep(effect, count, TURN_END);
+      for(pos = effect->phase; count > 0;
+          --count, pos += effect->spanStep, pixelIdx += stride)
+      {
+        zephyrLedEffectColorWheel((pos >> 8) & 0xff, &color);
+        zephyrLedStripStorePixel(strip, pixelIdx, &color);
+      }
+      return;
+    case LED_EFFECT_CHASE:
+      pos = effect->phase >> 8;
+      chaseCnt = pos == 0 ? 0 : effect->period - pos;
+      for(; count > 0; --count, pixelIdx += stride)
+      {
+        zephyrLedStripStorePixel(strip, pixelIdx,
+          chaseCnt < effect->length ? &effect->colorA : &effect->colorB);
+        if(++chaseCnt == effect->period)
+          chaseCnt = 0;
+      }
+      return;
+    default:
+      return;
+  }
+
+  for(; count > 0; --count, pixelIdx += stride)
+    zephyrLedStripStorePixel(strip, pixelIdx, &color);
+}
+
+/**
+ * @brief   Advance the effect phase to the next frame.
+ *
+ * @param effect    The effect.
+ */
+static void advancePhase(ZephyrLedEffect_t *effect)
+{
+  switch(effect->type)
+  {
+    case LED_EFFECT_RAINBOW:
+    case LED_EFFECT_BREATHE:
+      effect->phase = (effect->phase + effect->speed) & (TURN_END - 1);
+      break;
+    case LED_EFFECT_FADE:
+      effect->phase = MIN(effect->phase + effect->speed, effect->phaseEnd);
+      break;
+    case LED_EFFECT_CHASE:
+      effect->phase += effect->speed;
+      while(effect->phase >= effect->phaseEnd)
+        effect->phase -= effect->phaseEnd;
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * @brief   Reset the effect common fields.
+ *
+ * @param effect    The effect.
+ * @param type      The effect type.
+ */
+static void resetEffect(ZephyrLedEffect_t *effect, ZephyrLedEffectType_t type)
+{
+  memset(effect, 0x00, sizeof(*effect));
+  effect->type = type;
+}
+
+uint8_t zephyrLedEffectSine8(uint8_t angle)
+{
+  return sineTable[angle];
+}
+
+void zephyrLedEffectColorWheel(uint8_t hue, ZephyrRgbPixel_t *rgb)
+{
+  rgb->r = colorWheel[hue][0];
+  rgb->g = colorWheel[hue][1];
+  rgb->b = colorWheel[hue][2];
+}
+
+void zephyrLedEffectHsvToRgb(uint8_t hue, uint8_t sat, uint8_t val,
+                             ZephyrRgbPixel_t *rgb)
+{
+  uint32_t region;
+  uint32_t remainder;
+  uint8_t p;
+  uint8_t q;
+  uint8_t t;
+
+  /* hue * 6 / 256 gives the region and the remainder without a division. */
+  region = ((uint32_t)hue * 6) >> 8;
+  remainder = ((uint32_t)hue * 6) & 0xff;
+
+  p = (val * (255 - sat)) >> 8;
+  q = (val * (255 - ((sat * remainder) >> 8))) >> 8;
+  t = (val * (255 - ((sat * (255 - remainder)) >> 8))) >> 8;
+
+  switch(region)
+  {
+    case 0:
+      rgb->r = val; rgb->g = t; rgb->b = p;
+      break;
+    case 1:
+      rgb->r = q; rgb->g = val; rgb->b = p;
+      break;
+    case 2:
+      rgb->r = p; rgb->g = val; rgb->b = t;
+      break;
+    case 3:
+      rgb->r = p; rgb->g = q; rgb->b = val;
+      break;
+    case 4:
+      rgb->r = t; rgb->g = p; rgb->b = val;
+      break;
+    default:
+      rgb->r = val; rgb->g = p; rgb->b = q;
+      break;
+  }
+}
+
+void zephyrLedEffectBlend(const ZephyrRgbPixel_t *from,
+                          const ZephyrRgbPixel_t *to, uint8_t frac,
+                          ZephyrRgbPixel_t *rgb)
+{
+  /* map 0-255 to 0-256 so both ends are reached exactly. */
+  uint32_t weight = frac + (frac >> 7);
+
+  rgb->r = (from->r * (256 - weight) + to->r * weight) >> 8;
+  rgb->g = (from->g * (256 - weight) + to->g * weight) >> 8;
+  rgb->b = (from->b * (256 - weight) + to->b * weight) >> 8;
+}
+
+void zephyrLedEffectScale(const ZephyrRgbPixel_t *color, uint8_t scale,
+                          ZephyrRgbPixel_t *rgb)
+{
+  uint32_t weight = scale + 1;
+
+  rgb->r = (color->r * weight) >> 8;
+  rgb->g = (color->g * weight) >> 8;
+  rgb->b = (color->b * weight) >> 8;
+}
+
+void zephyrLedEffectInitFill(ZephyrLedEffect_t *effect,
+                             const ZephyrRgbPixel_t *color)
+{
+  resetEffect(effect, LED_EFFECT_FILL);
+  effect->colorA = *color;
+}
+
+void zephyrLedEffectInitGradient(ZephyrLedEffect_t *effect,
+                                 const ZephyrRgbPixel_t *from,
+                                 const ZephyrRgbPixel_t *to)
+{
+  resetEffect(effect, LED_EFFECT_GRADIENT);
+  effect->colorA = *from;
+  effect->colorB = *to;
+}
+
+void zephyrLedEffectInitRainbow(ZephyrLedEffect_t *effect, uint16_t speed)
+{
+  resetEffect(effect, LED_EFFECT_RAINBOW);
+  effect->speed = speed;
+}
+
+void zephyrLedEffectInitFade(ZephyrLedEffect_t *effect,
+                             const ZephyrRgbPixel_t *from,
+                             const ZephyrRgbPixel_t *to, uint32_t frameCnt)
+{
+  resetEffect(effect, LED_EFFECT_FADE);
+  effect->colorA = *from;
+  effect->colorB = *to;
+  effect->phaseEnd = FRACTION_END;
+  effect->speed = frameCnt > 0 ? DIV_ROUND_UP(FRACTION_END, frameCnt) :
+    FRACTION_END;
+}
+
+int zephyrLedEffectInitChase(ZephyrLedEffect_t *effect,
+                             const ZephyrRgbPixel_t *color,
+                             const ZephyrRgbPixel_t *bgColor, uint16_t length,
+                             uint16_t period, uint16_t speed)
+{
+  if(period == 0 || length > period)
+  {
+    LOG_ERR("invalid chase length (%d) for period (%d)", length, period);
+    return -EINVAL;
+  }
+
+  resetEffect(effect, LED_EFFECT_CHASE);
+  effect->colorA = *color;
+  effect->colorB = *bgColor;
+  effect->length = length;
+  effect->period = period;
+  effect->phaseEnd = (uint32_t)period << 8;
+  effect->speed = speed;
+
+  return 0;
+}
+
+void zephyrLedEffectInitBreathe(ZephyrLedEffect_t *effect,
+                                const ZephyrRgbPixel_t *color, uint16_t speed)
+{
+  resetEffect(effect, LED_EFFECT_BREATHE);
+  effect->colorA = *color;
+  effect->speed = speed;
+}
+
+bool zephyrLedEffectIsDone(ZephyrLedEffect_t *effect)
+{
+  return effect->type == LED_EFFECT_FADE && effect->phase >= effect->phaseEnd;
+}
+
+int zephyrLedEffectRender(ZephyrLedEffect_t *effect, ZephyrLedStrip_t *strip)
+{
+  return zephyrLedEffectRenderRange(effect, strip, 0, strip->pixelCount, false);
+}
+
+int zephyrLedEffectRenderRange(ZephyrLedEffect_t *effect,
+                               ZephyrLedStrip_t *strip, uint32_t offset,
+                               uint32_t count, bool reversed)
+{
+  if(!strip->dev || !strip->rgbPixels)
+  {
+    LOG_ERR("LED strip not yet initialized");
+    return -ENODEV;
+  }
+
+  if(offset > strip->pixelCount || count > strip->pixelCount - offset)
+  {
+    LOG_ERR("the given range (%d, %d) is out of range (%d)", offset, count,
+      strip->pixelCount);
+    return -EDOM;
+  }
+
+  if(count == 0)
+    return 0;
+
+  if(reversed)
+    renderSpan(effect, strip, offset + count - 1, count, -1);
+  else
+    renderSpan(effect, strip, offset, count, 1);
+  advancePhase(effect);
+
+  return 0;
+}
+
+/** @} */
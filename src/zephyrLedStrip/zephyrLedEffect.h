@@ -0,0 +1,221 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrLedEffect.h
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     LED Effect Wrapper
+ *
+ *            This file is the declaration of the LED strip effects. All the
+ *            effects are computed with integer and 8.8 fixed-point arithmetic
+ *            only. The per-pixel steps are computed once when the rendered
+ *            pixel count changes, so rendering a frame is O(pixels) with no
+ *            divisions.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#ifndef LED_EFFECT_WRAPPER
+#define LED_EFFECT_WRAPPER
+
+#include <zephyr/kernel.h>
+
+#include "zephyrLedStrip.h"
+
+/**
+ * @brief   The 8.8 fixed-point representation of 1.0.
+*/
+#define LED_EFFECT_FIXED_ONE          (1U << 8)
+
+/**
+ * @brief   The LED effect types.
+*/
+typedef enum
+{
+  LED_EFFECT_FILL,                  /**< The solid color fill effect. */
+  LED_EFFECT_GRADIENT,              /**< The two colors gradient effect. */
+  LED_EFFECT_RAINBOW,               /**< The scrolling rainbow effect. */
+  LED_EFFECT_FADE,                  /**< The two colors fade effect. */
+  LED_EFFECT_CHASE,                 /**< The chase effect. */
+  LED_EFFECT_BREATHE,               /**< The breathing effect. */
+} ZephyrLedEffectType_t;
+
+/**
+ * @brief   The LED effect data structure.
+*/
+typedef struct
+{
+  ZephyrLedEffectType_t type;       /**< The effect type. */
+  ZephyrRgbPixel_t colorA;          /**< The effect primary color. */
+  ZephyrRgbPixel_t colorB;          /**< The effect secondary color. */
+  uint32_t speed;                   /**< The phase increment per frame (8.8). */
+  uint32_t phase;                   /**< The current phase (8.8). */
+  uint32_t phaseEnd;                /**< The phase end value (8.8). */
+  uint16_t length;                  /**< The chase lit pixel count. */
+  uint16_t period;                  /**< The chase period in pixels. */
+  uint32_t spanCount;               /**< The span step count of the cached step. */
+  uint32_t spanStep;                /**< The cached per-pixel step (8.8). */
+} ZephyrLedEffect_t;
+
+/**
+ * @brief   Get the sine of an 8 bits angle.
+ *
+ * @param angle     The angle, 256 being a full turn.
+ *
+ * @return          The sine, scaled from 0 to 255.
+ */
+uint8_t zephyrLedEffectSine8(uint8_t angle);
+
+/**
+ * @brief   Get the fully saturated color of the color wheel.
+ *
+ * @param hue       The hue, 256 being a full turn.
+ * @param rgb       The output RGB color.
+ */
+void zephyrLedEffectColorWheel(uint8_t hue, ZephyrRgbPixel_t *rgb);
+
+/**
+ * @brief   Convert an HSV color to RGB.
+ *
+ * @param hue       The hue, 256 being a full turn.
+ * @param sat       The saturation.
+ * @param val       The value.
+ * @param rgb       The output RGB color.
+ */
+void zephyrLedEffectHsvToRgb(uint8_t hue, uint8_t sat, uint8_t val,
+                             ZephyrRgbPixel_t *rgb);
+
+/**
+ * @brief   Interpolate between two colors.
+ *
+ * @param from      The starting color.
+ * @param to        The ending color.
+ * @param frac      The fraction of the way from the starting color (0 to 255).
+ * @param rgb       The output RGB color.
+ */
+void zephyrLedEffectBlend(const ZephyrRgbPixel_t *from,
+                          const ZephyrRgbPixel_t *to, uint8_t frac,
+                          ZephyrRgbPixel_t *rgb);
+
+/**
+ * @brief   Scale a color.
+ *
+ * @param color     The color to scale.
+ * @param scale     The scale (255 keeps the color unchanged).
+ * @param rgb       The output RGB color.
+ */
+void zephyrLedEffectScale(const ZephyrRgbPixel_t *color, uint8_t scale,
+                          ZephyrRgbPixel_t *rgb);
+
+/**
+ * @brief   Initialize a solid color fill effect.
+ *
+ * @param effect    The effect to initialize.
+ * @param color     The fill color.
+ */
+void zephyrLedEffectInitFill(ZephyrLedEffect_t *effect,
+                             const ZephyrRgbPixel_t *color);
+
+/**
+ * @brief   Initialize a gradient effect going from one color to another along
+ *          the strip.
+ *
+ * @param effect    The effect to initialize.
+ * @param from      The color of the first pixel.
+ * @param to        The color of the last pixel.
+ */
+void zephyrLedEffectInitGradient(ZephyrLedEffect_t *effect,
+                                 const ZephyrRgbPixel_t *from,
+                                 const ZephyrRgbPixel_t *to);
+
+/**
+ * @brief   Initialize a rainbow effect spanning the whole color wheel along
+ *          the strip.
+ *
+ * @param effect    The effect to initialize.
+ * @param speed     The hue shift per frame (8.8).
+ */
+void zephyrLedEffectInitRainbow(ZephyrLedEffect_t *effect, uint16_t speed);
+
+/**
+ * @brief   Initialize a fade effect going from one color to another over
+ *          a number of frames.
+ *
+ * @param effect    The effect to initialize.
+ * @param from      The starting color.
+ * @param to        The ending color.
+ * @param frameCnt  The frame count of the fade.
+ */
+void zephyrLedEffectInitFade(ZephyrLedEffect_t *effect,
+                             const ZephyrRgbPixel_t *from,
+                             const ZephyrRgbPixel_t *to, uint32_t frameCnt);
+
+/**
+ * @brief   Initialize a chase effect.
+ *
+ * @param effect    The effect to initialize.
+ * @param color     The lit pixels color.
+ * @param bgColor   The background color.
+ * @param length    The lit pixel count in each period.
+ * @param period    The period of the pattern in pixels.
+ * @param speed     The pattern shift per frame in pixels (8.8).
+ *
+ * @return          0 if successful, the error code otherwise.
+ */
+int zephyrLedEffectInitChase(ZephyrLedEffect_t *effect,
+                             const ZephyrRgbPixel_t *color,
+                             const ZephyrRgbPixel_t *bgColor, uint16_t length,
+                             uint16_t period, uint16_t speed);
+
+/**
+ * @brief   Initialize a breathing effect.
+ *
+ * @param effect    The effect to initialize.
+ * @param color     The color at full brightness.
+ * @param speed     The sine phase increment per frame (8.8).
+ */
+void zephyrLedEffectInitBreathe(ZephyrLedEffect_t *effect,
+                                const ZephyrRgbPixel_t *color, uint16_t speed);
+
+/**
+ * @brief   Check if the effect is done. Only the fade effect ends, the others
+ *          run forever.
+ *
+ * @param effect    The effect.
+ *
+ * @return          true if the effect is done, false otherwise.
+ */
+bool zephyrLedEffectIsDone(ZephyrLedEffect_t *effect);
+
+/**
+ * @brief   Render the next effect frame in the strip pixels. The strip still
+ *          needs to be updated to show the frame.
+ *
+ * @param effect    The effect.
+ * @param strip     The LED strip.
+ *
+ * @return          0 if successful, the error code otherwise.
+ */
+int zephyrLedEffectRender(ZephyrLedEffect_t *effect, ZephyrLedStrip_t *strip);
+
+/**
+ * @brief   Render the next effect frame in a sub-range of the strip pixels.
+ *          The strip still needs to be updated to show the frame.
+ *
+ * @param effect    The effect.
+ * @param strip     The LED strip.
+ * @param offset    The index of the first pixel of the range.
+ * @param count     The pixel count of the range.
+ * @param reversed  The reversed direction flag, the effect starts at the last
+ *                  pixel of the range if set.
+ *
+ * @return          0 if successful, the error code otherwise.
+ */
+int zephyrLedEffectRenderRange(ZephyrLedEffect_t *effect,
+                               ZephyrLedStrip_t *strip, uint32_t offset,
+                               uint32_t count, bool reversed);
+
+#endif    /* LED_EFFECT_WRAPPER */
+
+/** @} */
@@ -0,0 +1,92 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrLedSegment.c
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     LED Segment Wrapper
+ *
+ *            This file is the implementation of the LED strip segments.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+#include "zephyrLedSegment.h"
+#include "zephyrCommon.h"
+
+LOG_MODULE_DECLARE(ZEPHYR_WRAPPER_MODULE_NAME);
+
+int zephyrLedSegmentInit(ZephyrLedSegment_t *segment, ZephyrLedStrip_t *strip,
+                         uint32_t offset, uint32_t pixelCnt, bool reversed)
+{
+  ZephyrRgbPixel_t black = RGB(0x00, 0x00, 0x00);
+
+  if(offset > strip->pixelCount || pixelCnt > strip->pixelCount - offset)
+  {
+    LOG_ERR("the segment (%d, %d) is out of the strip range (%d)", offset,
+      pixelCnt, strip->pixelCount);
+    return -EDOM;
+  }
+
+  segment->strip = strip;
+  segment->offset = offset;
+  segment->pixelCount = pixelCnt;
+  segment->reversed = reversed;
+  zephyrLedEffectInitFill(&segment->effect, &black);
+
+  return 0;
+}
+
+ZephyrLedEffect_t *zephyrLedSegmentGetEffect(ZephyrLedSegment_t *segment)
+{
+  return &segment->effect;
+}
+
+int zephyrLedSegmentSetPixel(ZephyrLedSegment_t *segment, uint32_t pixelIdx,
+                             const ZephyrRgbPixel_t *rgbPixel)
+{
+  uint32_t stripIdx;
+
+  if(pixelIdx >= segment->pixelCount)
+  {
+    LOG_ERR("the given pixel index (%d) is out of range (%d)", pixelIdx,
+      segment->pixelCount);
+    return -EDOM;
+  }
+
+  if(segment->reversed)
+    stripIdx = segment->offset + segment->pixelCount - 1 - pixelIdx;
+  else
+    stripIdx = segment->offset + pixelIdx;
+
+  return zephyrLedStripSetPixel(segment->strip, stripIdx, rgbPixel);
+}
+
+int zephyrLedSegmentRender(ZephyrLedSegment_t *segment)
+{
+  return zephyrLedEffectRenderRange(&segment->effect, segment->strip,
+    segment->offset, segment->pixelCount, segment->reversed);
+}
+
+int zephyrLedSegmentRenderAll(ZephyrLedSegment_t *segments, size_t count)
+{
+  int rc;
+
+  for(size_t i = 0; i < count; ++i)
+  {
+    rc = zephyrLedSegmentRender(segments + i);
+    if(rc < 0)
+    {
+      LOG_ERR("unable to render segment %zu", i);
+      return rc;
+    }
+  }
+
+  return 0;
+}
+
+/** @} */
@@ -0,0 +1,98 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrLedSegment.h
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     LED Segment Wrapper
+ *
+ *            This file is the declaration of the LED strip segments. A segment
+ *            is a logical sub-range of a strip with its own offset, direction
+ *            and effect.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#ifndef LED_SEGMENT_WRAPPER
+#define LED_SEGMENT_WRAPPER
+
+#include <zephyr/kernel.h>
+
+#include "zephyrLedStrip.h"
+#include "zephyrLedEffect.h"
+
+/**
+ * @brief   The LED segment data structure.
+*/
+typedef struct
+{
+  ZephyrLedStrip_t *strip;          /**< The LED strip of the segment. */
+  uint32_t offset;                  /**< The first strip pixel of the segment. */
+  uint32_t pixelCount;              /**< The pixel count of the segment. */
+  bool reversed;                    /**< The reversed direction flag. */
+  ZephyrLedEffect_t effect;         /**< The segment effect. */
+} ZephyrLedSegment_t;
+
+/**
+ * @brief   Initialize a segment. The segment effect is initialized to a black
+ *          fill.
+ *
+ * @param segment   The segment to initialize.
+ * @param strip     The LED strip of the segment.
+ * @param offset    The index of the first strip pixel of the segment.
+ * @param pixelCnt  The pixel count of the segment.
+ * @param reversed  The reversed direction flag, the segment first pixel is
+ *                  the last pixel of the range if set.
+ *
+ * @return          0 if successful, the error code otherwise.
+ */
+int zephyrLedSegmentInit(ZephyrLedSegment_t *segment, ZephyrLedStrip_t *strip,
+                         uint32_t offset, uint32_t pixelCnt, bool reversed);
+
+/**
+ * @brief   Get the segment effect, to be initialized with one of the effect
+ *          initialization functions.
+ *
+ * @param segment   The segment.
+ *
+ * @return          The segment effect.
+ */
+ZephyrLedEffect_t *zephyrLedSegmentGetEffect(ZephyrLedSegment_t *segment);
+
+/**
+ * @brief   Set the desired segment pixel RGB color.
+ *
+ * @param segment   The segment.
+ * @param pixelIdx  The index of the pixel in the segment.
+ * @param rgbPixel  The pixel new RGB color.
+ *
+ * @return          0 if successful, the error code otherwise.
+ */
+int zephyrLedSegmentSetPixel(ZephyrLedSegment_t *segment, uint32_t pixelIdx,
+                             const ZephyrRgbPixel_t *rgbPixel);
+
+/**
+ * @brief   Render the next frame of the segment effect. The strip still needs
+ *          to be updated to show the frame.
+ *
+ * @param segment   The segment.
+ *
+ * @return          0 if successful, the error code otherwise.
+ */
+int zephyrLedSegmentRender(ZephyrLedSegment_t *segment);
+
+/**
+ * @brief   Render the next frame of several segments.
+ *
+ * @param segments  The segments.
+ * @param count     The segment count.
+ *
+ * @return          0 if successful, the error code of the first failing
+ *                  segment otherwise.
+ */
+int zephyrLedSegmentRenderAll(ZephyrLedSegment_t *segments, size_t count);
+
+#endif    /* LED_SEGMENT_WRAPPER */
+
+/** @} */
@@ -22,9 +22,357 @@
 
 LOG_MODULE_DECLARE(ZEPHYR_WRAPPER_MODULE_NAME);
 
+/**
+ * @brief   The pixel storage size of each pixel format.
+*/
+static const uint8_t pixelSizes[] = {
+  [LED_PIXEL_FMT_NATIVE] = sizeof(ZephyrRgbPixel_t),
+  [LED_PIXEL_FMT_RGB888] = 3,
+  [LED_PIXEL_FMT_GRB888] = 3,
+  [LED_PIXEL_FMT_RGBW] = 4,
+  [LED_PIXEL_FMT_RGB565] = 2,
+};
+
+/**
+ * @brief   Pack a pixel in the given storage format.
+ *
+ * @param format    The storage format.
+ * @param packed    The packed pixel.
+ * @param rgbPixel  The pixel to pack.
+ */
+static void packPixel(ZephyrLedPixelFormat_t format, uint8_t *packed,
+                      const ZephyrRgbPixel_t *rgbPixel)
+{
+  uint8_t white;
+  uint16_t rgb565;
+
+  switch(format)
+  {
+    case LED_PIXEL_FMT_RGB888:
+      packed[0] = rgbPixel->r;
+      packed[1] = rgbPixel->g;
+      packed[2] = rgbPixel->b;
+      break;
+    case LED_PIXEL_FMT_GRB888:
+      packed[0] = rgbPixel->g;
+      packed[1] = rgbPixel->r;
+      packed[2] = rgbPixel->b;
+      break;
+    case LED_PIXEL_FMT_RGBW:
+      /* the common part of the 3 channels goes to the white channel. */
+      white = MIN(rgbPixel->r, MIN(rgbPixel->g, rgbPixel->b));
+      packed[0] = rgbPixel->r - white;
+      packed[1] = rgbPixel->g - white;
+      packed[2] = rgbPixel->b - white;
+      packed[3] = white;
+      break;
+    case LED_PIXEL_FMT_RGB565:
+      rgb565 = ((rgbPixel->r & 0xf8) << 8) | ((rgbPixel->g & 0xfc) << 3) |
+        (rgbPixel->b >> 3);
+      packed[0] = rgb565 >> 8;
+      packed[1] = rgb565 & 0xff;
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * @brief   Unpack a pixel from the given storage format.
+ *
+ * @param format    The storage format.
+ * @param packed    The packed pixel.
+ * @param rgbPixel  The unpacked pixel.
+ */
+static void unpackPixel(ZephyrLedPixelFormat_t format, const uint8_t *packed,
+                        ZephyrRgbPixel_t *rgbPixel)
+{
+  uint8_t channel;
+
+  switch(format)
+  {
+    case LED_PIXEL_FMT_RGB888:
+      rgbPixel->r = packed[0];
+      rgbPixel->g = packed[1];
+      rgbPixel->b = packed[2];
+      break;
+    case LED_PIXEL_FMT_GRB888:
+      rgbPixel->r = packed[1];
+      rgbPixel->g = packed[0];
+      rgbPixel->b = packed[2];
+      break;
+    case LED_PIXEL_FMT_RGBW:
+      /* the driver has no white channel, it is blended in the 3 channels. */
+      rgbPixel->r = MIN(packed[0] + packed[3], 0xff);
+      rgbPixel->g = MIN(packed[1] + packed[3], 0xff);
+      rgbPixel->b = MIN(packed[2] + packed[3], 0xff);
+      break;
+    case LED_PIXEL_FMT_RGB565:
+      channel = packed[0] & 0xf8;
+      rgbPixel->r = channel | (channel >> 5);
+      channel = ((packed[0] & 0x07) << 5) | ((packed[1] & 0xe0) >> 3);
+      rgbPixel->g = channel | (channel >> 6);
+      channel = packed[1] << 3;
+      rgbPixel->b = channel | (channel >> 5);
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * @brief   Convert the packed pixels to the driver format in a single pass.
+ *
+ * @param strip     The LED strip.
+ */
+static void convertPackedPixels(ZephyrLedStrip_t *strip)
+{
+  const uint8_t *packed = strip->packedPixels;
+  ZephyrRgbPixel_t *rgbPixel = strip->rgbPixels;
+  ZephyrRgbPixel_t *end = strip->rgbPixels + strip->pixelCount;
+  size_t pixelSize = pixelSizes[strip->format];
+
+  /* the format dispatch is out of the loop for the 3 bytes formats. */
+  switch(strip->format)
+  {
+    case LED_PIXEL_FMT_RGB888:
+      for(; rgbPixel < end; ++rgbPixel, packed += 3)
+      {
+        rgbPixel->r = packed[0];
+        rgbPixel->g = packed[1];
+        rgbPixel->b = packed[2];
+      }
+      break;
+    case LED_PIXEL_FMT_GRB888:
+      for(; rgbPixel < end; ++rgbPixel, packed += 3)
+      {
+        rgbPixel->r = packed[1];
+        rgbPixel->g = packed[0];
+        rgbPixel->b = packed[2];
+      }
+      break;
+    default:
+      for(; rgbPixel < end; ++rgbPixel, packed += pixelSize)
+        unpackPixel(strip->format, packed, rgbPixel);
+      break;
+  }
+}
+
+#ifdef CONFIG_ENYA_LED_STRIP_DITHER
+/**
+ * @brief   Dither a 16 bits channel to 8 bits.
+ *
+ * @param value     The 16 bits channel value.
+ * @param error     The channel error accumulator.
+ *
+ * @return          The 8 bits channel value.
+ */
+static inline uint8_t ditherChannel(uint32_t value, uint8_t *error)
+{
+  value += *error;
+  *error = value & 0xff;
+
+  return MIN(value >> 8, 0xff);
+}
+
+/**
+ * @brief   Scale and dither the 16 bits pixels to the driver pixels.
+ *
+ * @param strip     The LED strip.
+ * @param scale     The additional frame scale (256 keeps the frame unchanged).
+ */
+static void ditherPixels(ZephyrLedStrip_t *strip, uint32_t scale)
+{
+  const ZephyrRgb16Pixel_t *hiRes = strip->hiResPixels;
+  uint8_t *error = strip->ditherErrors;
+  ZephyrRgbPixel_t *rgbPixel = strip->rgbPixels;
+  ZephyrRgbPixel_t *end = strip->rgbPixels + strip->pixelCount;
+
+  scale = (((uint32_t)strip->brightness + 1) * scale) >> 8;
+
+  for(; rgbPixel < end; ++rgbPixel, ++hiRes, error += 3)
+  {
+    rgbPixel->r = ditherChannel((hiRes->r * scale) >> 16, error);
+    rgbPixel->g = ditherChannel((hiRes->g * scale) >> 16, error + 1);
+    rgbPixel->b = ditherChannel((hiRes->b * scale) >> 16, error + 2);
+  }
+}
+#endif
+
+/**
+ * @brief   Check if the strip pixels can be copied directly to the driver
+ *          pixels, without conversion nor accounting.
+ *
+ * @param strip     The LED strip.
+ *
+ * @return          true if the pixels can be copied, false otherwise.
+ */
+static inline bool isDirectStorage(ZephyrLedStrip_t *strip)
+{
+#ifdef CONFIG_ENYA_LED_STRIP_DITHER
+  if(strip->hiResPixels)
+    return false;
+#endif
+#ifdef CONFIG_ENYA_LED_STRIP_POWER_LIMIT
+  if(strip->powerLimit.budgetMa > 0)
+    return false;
+#endif
+
+  return strip->format == LED_PIXEL_FMT_NATIVE;
+}
+
+#ifdef CONFIG_ENYA_LED_STRIP_POWER_LIMIT
+/**
+ * @brief   Update the running channel sums for a pixel change.
+ *
+ * @param strip     The LED strip.
+ * @param old       The previous pixel.
+ * @param new       The new pixel.
+ */
+static inline void accountPixel(ZephyrLedStrip_t *strip,
+                                const ZephyrRgbPixel_t *old,
+                                const ZephyrRgbPixel_t *new)
+{
+  strip->channelSums[0] += new->r - old->r;
+  strip->channelSums[1] += new->g - old->g;
+  strip->channelSums[2] += new->b - old->b;
+}
+
+/**
+ * @brief   Recount the channel sums from the stored pixels.
+ *
+ * @param strip     The LED strip.
+ */
+static void recountChannelSums(ZephyrLedStrip_t *strip)
+{
+  ZephyrRgbPixel_t pixel;
+
+  memset(strip->channelSums, 0x00, sizeof(strip->channelSums));
+  for(uint32_t i = 0; i < strip->pixelCount; ++i)
+  {
+    zephyrLedStripLoadPixel(strip, i, &pixel);
+    strip->channelSums[0] += pixel.r;
+    strip->channelSums[1] += pixel.g;
+    strip->channelSums[2] += pixel.b;
+  }
+}
+
+/**
+ * @brief   Estimate the pixels current, the software brightness included.
+ *
+ * @param strip     The LED strip.
+ *
+ * @return          The pixels current in mA, multiplied by 255.
+ */
+static uint64_t estimatePixelsCurrent(ZephyrLedStrip_t *strip)
+{
+  ZephyrLedPowerLimit_t *limit = &strip->powerLimit;
+  uint64_t estimate;
+
+  estimate = (uint64_t)strip->channelSums[0] * limit->redMa +
+    (uint64_t)strip->channelSums[1] * limit->greenMa +
+    (uint64_t)strip->channelSums[2] * limit->blueMa;
+
+#ifdef CONFIG_ENYA_LED_STRIP_DITHER
+  /* the brightness is applied with the frame scale when dithering. */
+  if(strip->hiResPixels)
+    estimate = (estimate * ((uint32_t)strip->brightness + 1)) >> 16;
+#endif
+
+  return estimate;
+}
+
+/**
+ * @brief   Compute the frame scale keeping the estimated current within the
+ *          budget. This only divides when the budget is exceeded.
+ *
+ * @param strip     The LED strip.
+ *
+ * @return          The frame scale (256 keeps the frame unchanged).
+ */
+static uint32_t computePowerScale(ZephyrLedStrip_t *strip)
+{
+  ZephyrLedPowerLimit_t *limit = &strip->powerLimit;
+  uint64_t idle = (uint64_t)limit->idleMa * strip->pixelCount;
+  uint64_t available;
+  uint64_t estimate;
+
+  if(limit->budgetMa == 0)
+    return 256;
+
+  if(idle >= limit->budgetMa)
+    return 0;
+
+  /* both sides are kept multiplied by 255 to avoid the per-frame division. */
+  available = (limit->budgetMa - idle) * 255;
+  estimate = estimatePixelsCurrent(strip);
+
+  if(estimate <= available)
+    return 256;
+
+  return (available << 8) / estimate;
+}
+#else
+/**
+ * @brief   Compute the frame scale, the power limit is not available.
+ *
+ * @param strip     The LED strip.
+ *
+ * @return          The frame scale (256 keeps the frame unchanged).
+ */
+static inline uint32_t computePowerScale(ZephyrLedStrip_t *strip)
+{
+  return 256;
+}
+
+#endif
+
+/**
+ * @brief   Scale pixels, in place if the source is the destination.
+ *
+ * @param dst       The scaled pixels.
+ * @param src       The pixels to scale.
+ * @param count     The pixel count.
+ * @param scale     The scale (256 keeps the pixels unchanged).
+ */
+static void scalePixels(ZephyrRgbPixel_t *dst, const ZephyrRgbPixel_t *src,
+                        uint32_t count, uint32_t scale)
+{
+  const ZephyrRgbPixel_t *end = src + count;
+
+  for(; src < end; ++src, ++dst)
+  {
+    dst->r = (src->r * scale) >> 8;
+    dst->g = (src->g * scale) >> 8;
+    dst->b = (src->b * scale) >> 8;
+  }
+}
+
+/**
+ * @brief   Reset the optional strip features.
+ *
+ * @param strip     The LED strip.
+ */
+static void resetStripFeatures(ZephyrLedStrip_t *strip)
+{
+  strip->packedPixels = NULL;
+  strip->format = LED_PIXEL_FMT_NATIVE;
+#ifdef CONFIG_ENYA_LED_STRIP_DITHER
+  strip->hiResPixels = NULL;
+  strip->ditherErrors = NULL;
+  strip->brightness = UINT16_MAX;
+#endif
+#ifdef CONFIG_ENYA_LED_STRIP_POWER_LIMIT
+  memset(&strip->powerLimit, 0x00, sizeof(strip->powerLimit));
+  memset(strip->channelSums, 0x00, sizeof(strip->channelSums));
+  strip->limitPixels = NULL;
+#endif
+}
+
 int zephyrLedStripInit(ZephyrLedStrip_t *strip, uint32_t pixelCnt)
 {
   strip->rgbPixels = NULL;
+  resetStripFeatures(strip);
 
   if(device_is_ready(strip->dev))
     LOG_DBG("initializing strip %s with %d pixels", strip->dev->name, pixelCnt);
@@ -47,6 +395,129 @@ int zephyrLedStripInit(ZephyrLedStrip_t *strip, uint32_t pixelCnt)
   return 0;
 }
 
+int zephyrLedStripInitPacked(ZephyrLedStrip_t *strip, uint32_t pixelCnt,
+                             ZephyrLedPixelFormat_t format,
+                             ZephyrRgbPixel_t *xferBuf)
+{
+  if(format == LED_PIXEL_FMT_NATIVE)
+    return zephyrLedStripInit(strip, pixelCnt);
+
+  strip->rgbPixels = NULL;
+  resetStripFeatures(strip);
+
+  if(format >= ARRAY_SIZE(pixelSizes))
+  {
+    LOG_ERR("invalid pixel format %d", format);
+    return -EINVAL;
+  }
+
+  if(!xferBuf)
+  {
+    LOG_ERR("the packed pixel format needs a transfer buffer");
+    return -EINVAL;
+  }
+
+  if(device_is_ready(strip->dev))
+    LOG_DBG("initializing strip %s with %d packed pixels", strip->dev->name,
+      pixelCnt);
+  else
+  {
+    LOG_ERR("strip device %s not ready", strip->dev->name);
+    return -ENODEV;
+  }
+
+  strip->packedPixels = k_malloc(pixelCnt * pixelSizes[format]);
+  if(!strip->packedPixels)
+  {
+    LOG_ERR("unable to allocate memory for %d X packed pixel", pixelCnt);
+    return -ENOSPC;
+  }
+  memset(strip->packedPixels, 0x00, pixelCnt * pixelSizes[format]);
+
+  strip->rgbPixels = xferBuf;
+  strip->format = format;
+  strip->pixelCount = pixelCnt;
+
+  return 0;
+}
+
+size_t zephyrLedStripGetPixelSize(ZephyrLedPixelFormat_t format)
+{
+  if(format >= ARRAY_SIZE(pixelSizes))
+    return 0;
+
+  return pixelSizes[format];
+}
+
+/**
+ * @brief   Store a pixel in the strip storage format.
+ *
+ * @param strip     The LED strip.
+ * @param pixelIdx  The index of the pixel to set the color.
+ * @param rgbPixel  The pixel new RGB color.
+ */
+static void storePixel(ZephyrLedStrip_t *strip, uint32_t pixelIdx,
+                       const ZephyrRgbPixel_t *rgbPixel)
+{
+#ifdef CONFIG_ENYA_LED_STRIP_DITHER
+  if(strip->hiResPixels)
+  {
+    /* x * 257 maps 0-255 to the full 0-65535 range. */
+    strip->hiResPixels[pixelIdx].r = rgbPixel->r * 257;
+    strip->hiResPixels[pixelIdx].g = rgbPixel->g * 257;
+    strip->hiResPixels[pixelIdx].b = rgbPixel->b * 257;
+    return;
+  }
+#endif
+
+  if(strip->format == LED_PIXEL_FMT_NATIVE)
+    strip->rgbPixels[pixelIdx] = *rgbPixel;
+  else
+    packPixel(strip->format,
+      strip->packedPixels + pixelIdx * pixelSizes[strip->format], rgbPixel);
+}
+
+void zephyrLedStripStorePixel(ZephyrLedStrip_t *strip, uint32_t pixelIdx,
+                              const ZephyrRgbPixel_t *rgbPixel)
+{
+#ifdef CONFIG_ENYA_LED_STRIP_POWER_LIMIT
+  ZephyrRgbPixel_t old;
+  ZephyrRgbPixel_t new;
+
+  if(strip->powerLimit.budgetMa > 0)
+  {
+    /* the stored value is read back since some formats are lossy. */
+    zephyrLedStripLoadPixel(strip, pixelIdx, &old);
+    storePixel(strip, pixelIdx, rgbPixel);
+    zephyrLedStripLoadPixel(strip, pixelIdx, &new);
+    accountPixel(strip, &old, &new);
+    return;
+  }
+#endif
+
+  storePixel(strip, pixelIdx, rgbPixel);
+}
+
+void zephyrLedStripLoadPixel(ZephyrLedStrip_t *strip, uint32_t pixelIdx,
+                             ZephyrRgbPixel_t *rgbPixel)
+{
+#ifdef CONFIG_ENYA_LED_STRIP_DITHER
+  if(strip->hiResPixels)
+  {
+    rgbPixel->r = strip->hiResPixels[pixelIdx].r >> 8;
+    rgbPixel->g = strip->hiResPixels[pixelIdx].g >> 8;
+    rgbPixel->b = strip->hiResPixels[pixelIdx].b >> 8;
+    return;
+  }
+#endif
+
+  if(strip->format == LED_PIXEL_FMT_NATIVE)
+    *rgbPixel = strip->rgbPixels[pixelIdx];
+  else
+    unpackPixel(strip->format,
+      strip->packedPixels + pixelIdx * pixelSizes[strip->format], rgbPixel);
+}
+
 uint32_t zephyrLedStripGetPixelCnt(ZephyrLedStrip_t *strip)
 {
   return strip->pixelCount;
@@ -61,15 +532,41 @@ int zephyrLedStripSetPixel(ZephyrLedStrip_t *strip, uint32_t pixelIdx,
     return -ENODEV;
   }
 
-  if(pixelIdx > strip->pixelCount)
+  if(pixelIdx >= strip->pixelCount)
+  {
+    LOG_ERR("the given pixel index (%d) is out of range (%d)", pixelIdx,
+      strip->pixelCount);
+    return -EDOM;
+  }
+
+  if(isDirectStorage(strip))
+  {
+    memset(strip->rgbPixels + pixelIdx, 0x00, sizeof(ZephyrRgbPixel_t));
+    memcpy(strip->rgbPixels + pixelIdx, rgbPixel, sizeof(ZephyrRgbPixel_t));
+  }
+  else
+    zephyrLedStripStorePixel(strip, pixelIdx, rgbPixel);
+
+  return 0;
+}
+
+int zephyrLedStripGetPixel(ZephyrLedStrip_t *strip, uint32_t pixelIdx,
+                           ZephyrRgbPixel_t *rgbPixel)
+{
+  if(!strip->dev || !strip->rgbPixels)
+  {
+    LOG_ERR("LED strip not yet initialized");
+    return -ENODEV;
+  }
+
+  if(pixelIdx >= strip->pixelCount)
   {
     LOG_ERR("the given pixel index (%d) is out of range (%d)", pixelIdx,
       strip->pixelCount);
     return -EDOM;
   }
 
-  memset(strip->rgbPixels + pixelIdx, 0x00, sizeof(ZephyrRgbPixel_t));
-  memcpy(strip->rgbPixels + pixelIdx, rgbPixel, sizeof(ZephyrRgbPixel_t));
+  zephyrLedStripLoadPixel(strip, pixelIdx, rgbPixel);
 
   return 0;
 }
@@ -107,16 +604,184 @@ int zephyrLedStripSetPixels(ZephyrLedStrip_t *strip, uint32_t start,
   }
 
   pixelCount = end - start;
-  memset(strip->rgbPixels + start, 0x00, pixelCount * sizeof(ZephyrRgbPixel_t));
-  memcpy(strip->rgbPixels + start, rgbPixels,
-    pixelCount * sizeof(ZephyrRgbPixel_t));
+  if(isDirectStorage(strip))
+  {
+    memset(strip->rgbPixels + start, 0x00,
+      pixelCount * sizeof(ZephyrRgbPixel_t));
+    memcpy(strip->rgbPixels + start, rgbPixels,
+      pixelCount * sizeof(ZephyrRgbPixel_t));
+  }
+  else
+    for(uint32_t i = 0; i < pixelCount; ++i)
+      zephyrLedStripStorePixel(strip, start + i, rgbPixels + i);
 
   return 0;
 }
 
+#ifdef CONFIG_ENYA_LED_STRIP_DITHER
+int zephyrLedStripEnableDither(ZephyrLedStrip_t *strip)
+{
+  if(!strip->dev || !strip->rgbPixels)
+  {
+    LOG_ERR("LED strip not yet initialized");
+    return -ENODEV;
+  }
+
+  if(strip->format != LED_PIXEL_FMT_NATIVE)
+  {
+    LOG_ERR("only the native pixel format can be dithered");
+    return -ENOTSUP;
+  }
+
+  if(strip->hiResPixels)
+    return 0;
+
+  strip->ditherErrors = k_malloc(strip->pixelCount * 3);
+  if(!strip->ditherErrors)
+  {
+    LOG_ERR("unable to allocate memory for %d X dithering error",
+      strip->pixelCount);
+    return -ENOSPC;
+  }
+  memset(strip->ditherErrors, 0x00, strip->pixelCount * 3);
+
+  strip->hiResPixels = k_malloc(strip->pixelCount * sizeof(ZephyrRgb16Pixel_t));
+  if(!strip->hiResPixels)
+  {
+    LOG_ERR("unable to allocate memory for %d X 16 bits pixel",
+      strip->pixelCount);
+    k_free(strip->ditherErrors);
+    strip->ditherErrors = NULL;
+    return -ENOSPC;
+  }
+
+  /* keep the current frame, the store path now goes to the 16 bits pixels. */
+  for(uint32_t i = 0; i < strip->pixelCount; ++i)
+    storePixel(strip, i, strip->rgbPixels + i);
+
+#ifdef CONFIG_ENYA_LED_STRIP_POWER_LIMIT
+  if(strip->powerLimit.budgetMa > 0)
+    recountChannelSums(strip);
+#endif
+
+  return 0;
+}
+
+int zephyrLedStripSetPixel16(ZephyrLedStrip_t *strip, uint32_t pixelIdx,
+                             const ZephyrRgb16Pixel_t *pixel)
+{
+  if(!strip->hiResPixels)
+  {
+    LOG_ERR("LED strip dithering not enabled");
+    return -ENODEV;
+  }
+
+  if(pixelIdx >= strip->pixelCount)
+  {
+    LOG_ERR("the given pixel index (%d) is out of range (%d)", pixelIdx,
+      strip->pixelCount);
+    return -EDOM;
+  }
+
+#ifdef CONFIG_ENYA_LED_STRIP_POWER_LIMIT
+  ZephyrRgbPixel_t old;
+  ZephyrRgbPixel_t new;
+
+  zephyrLedStripLoadPixel(strip, pixelIdx, &old);
+  strip->hiResPixels[pixelIdx] = *pixel;
+  zephyrLedStripLoadPixel(strip, pixelIdx, &new);
+  accountPixel(strip, &old, &new);
+#else
+  strip->hiResPixels[pixelIdx] = *pixel;
+#endif
+
+  return 0;
+}
+
+int zephyrLedStripSetBrightness(ZephyrLedStrip_t *strip, uint16_t brightness)
+{
+  if(!strip->hiResPixels)
+  {
+    LOG_ERR("LED strip dithering not enabled");
+    return -ENODEV;
+  }
+
+  strip->brightness = brightness;
+
+  return 0;
+}
+#endif
+
+#ifdef CONFIG_ENYA_LED_STRIP_POWER_LIMIT
+int zephyrLedStripSetPowerLimit(ZephyrLedStrip_t *strip,
+                                const ZephyrLedPowerLimit_t *limit)
+{
+  bool keepFrame;
+
+  if(!strip->dev || !strip->rgbPixels)
+  {
+    LOG_ERR("LED strip not yet initialized");
+    return -ENODEV;
+  }
+
+  /* the driver may modify the sent frame, the native frame is kept apart. */
+  keepFrame = strip->format == LED_PIXEL_FMT_NATIVE && !strip->limitPixels;
+#ifdef CONFIG_ENYA_LED_STRIP_DITHER
+  keepFrame = keepFrame && !strip->hiResPixels;
+#endif
+  if(limit->budgetMa > 0 && keepFrame)
+  {
+    strip->limitPixels = k_malloc(strip->pixelCount * sizeof(ZephyrRgbPixel_t));
+    if(!strip->limitPixels)
+    {
+      LOG_ERR("unable to allocate memory for %d X RGB pixel",
+        strip->pixelCount);
+      return -ENOSPC;
+    }
+  }
+
+  strip->powerLimit = *limit;
+  recountChannelSums(strip);
+
+  return 0;
+}
+
+uint32_t zephyrLedStripGetCurrentEstimate(ZephyrLedStrip_t *strip)
+{
+  ZephyrLedPowerLimit_t *limit = &strip->powerLimit;
+
+  return estimatePixelsCurrent(strip) / 255 +
+    (uint32_t)limit->idleMa * strip->pixelCount;
+}
+#endif
+
+/**
+ * @brief   Get the buffer sent to the driver.
+ *
+ * @param strip     The LED strip.
+ *
+ * @return          The power limit transfer buffer if the native frame must be
+ *                  kept, the driver pixels otherwise.
+ */
+static inline ZephyrRgbPixel_t *getXferPixels(ZephyrLedStrip_t *strip)
+{
+#ifdef CONFIG_ENYA_LED_STRIP_DITHER
+  if(strip->hiResPixels)
+    return strip->rgbPixels;
+#endif
+#ifdef CONFIG_ENYA_LED_STRIP_POWER_LIMIT
+  if(strip->powerLimit.budgetMa > 0 && strip->limitPixels)
+    return strip->limitPixels;
+#endif
+
+  return strip->rgbPixels;
+}
+
 int zephyrLedStripUpdate(ZephyrLedStrip_t *strip)
 {
   int rc;
+  uint32_t scale;
+  ZephyrRgbPixel_t *xferPixels;
 
   if(!strip->dev || !strip->rgbPixels)
   {
@@ -124,7 +789,29 @@ int zephyrLedStripUpdate(ZephyrLedStrip_t *strip)
     return -ENODEV;
   }
 
-  rc = led_strip_update_rgb(strip->dev, strip->rgbPixels, strip->pixelCount);
+  scale = computePowerScale(strip);
+
+#ifdef CONFIG_ENYA_LED_STRIP_DITHER
+  if(strip->hiResPixels)
+  {
+    ditherPixels(strip, scale);
+    scale = 256;
+  }
+  else
+#endif
+  if(strip->format != LED_PIXEL_FMT_NATIVE)
+    convertPackedPixels(strip);
+
+  xferPixels = getXferPixels(strip);
+  if(scale < 256)
+    LOG_DBG("strip %s limited to %d/256", strip->dev->name, scale);
+
+  if(xferPixels != strip->rgbPixels)
+    scalePixels(xferPixels, strip->rgbPixels, strip->pixelCount, scale);
+  else if(scale < 256)
+    scalePixels(xferPixels, xferPixels, strip->pixelCount, scale);
+
+  rc = led_strip_update_rgb(strip->dev, xferPixels, strip->pixelCount);
 
   return rc;
 }
@@ -29,6 +29,40 @@
 */
 typedef struct led_rgb ZephyrRgbPixel_t;
 
+/**
+ * @brief   The 16 bits per channel pixel type.
+*/
+typedef struct
+{
+  uint16_t r;                       /**< The red channel. */
+  uint16_t g;                       /**< The green channel. */
+  uint16_t b;                       /**< The blue channel. */
+} ZephyrRgb16Pixel_t;
+
+/**
+ * @brief   The LED strip power limit configuration.
+*/
+typedef struct
+{
+  uint32_t budgetMa;                /**< The current budget in mA, 0 to disable. */
+  uint16_t redMa;                   /**< The red channel current at 255 in mA. */
+  uint16_t greenMa;                 /**< The green channel current at 255 in mA. */
+  uint16_t blueMa;                  /**< The blue channel current at 255 in mA. */
+  uint16_t idleMa;                  /**< The idle current of a pixel in mA. */
+} ZephyrLedPowerLimit_t;
+
+/**
+ * @brief   The pixel storage formats.
+*/
+typedef enum
+{
+  LED_PIXEL_FMT_NATIVE,             /**< The driver pixel format, no conversion. */
+  LED_PIXEL_FMT_RGB888,             /**< The packed 3 bytes RGB format. */
+  LED_PIXEL_FMT_GRB888,             /**< The packed 3 bytes GRB format. */
+  LED_PIXEL_FMT_RGBW,               /**< The packed 4 bytes RGBW format. */
+  LED_PIXEL_FMT_RGB565,             /**< The packed 2 bytes RGB565 format. */
+} ZephyrLedPixelFormat_t;
+
 /**
  * @brief   The LED strip data structure.
 */
@@ -36,7 +70,19 @@ typedef struct
 {
   const struct device *dev;         /**< The Zephyr device of the led strip. */
   uint32_t pixelCount;              /**< The pixel count in the led strip. */
-  ZephyrRgbPixel_t *rgbPixels;      /**< The array of RGB pixel of the strip. */
+  ZephyrRgbPixel_t *rgbPixels;      /**< The array of RGB pixel sent to the driver. */
+  ZephyrLedPixelFormat_t format;    /**< The pixel storage format. */
+  uint8_t *packedPixels;            /**< The packed pixel storage, if not native. */
+#ifdef CONFIG_ENYA_LED_STRIP_DITHER
+  ZephyrRgb16Pixel_t *hiResPixels;  /**< The 16 bits pixels, if dithering. */
+  uint8_t *ditherErrors;            /**< The per-channel dithering errors. */
+  uint16_t brightness;              /**< The software brightness. */
+#endif
+#ifdef CONFIG_ENYA_LED_STRIP_POWER_LIMIT
+  ZephyrLedPowerLimit_t powerLimit; /**< The power limit configuration. */
+  uint32_t channelSums[3];          /**< The running RGB channel sums. */
+  ZephyrRgbPixel_t *limitPixels;    /**< The native limited frame sent. */
+#endif
 } ZephyrLedStrip_t;
 
 /**
@@ -50,6 +96,34 @@ typedef struct
  */
 int zephyrLedStripInit(ZephyrLedStrip_t *strip, const uint32_t pixelCnt);
 
+/**
+ * @brief   Initialize the LED strip with a packed pixel storage. The pixels
+ *          are converted to the driver format in the transfer buffer at update
+ *          time, since the driver takes the whole frame at once. Strips whose
+ *          updates never overlap can share the same transfer buffer, so the
+ *          packed storage only saves memory when it is shared. Members of the
+ *          same strip group are updated in parallel and need their own.
+ *
+ * @param strip     The LED strip data structure to initialize.
+ * @param pixelCnt  The pixel count of the strip.
+ * @param format    The pixel storage format.
+ * @param xferBuf   The transfer buffer of at least pixelCnt pixels.
+ *
+ * @return          0 if successful, the error code otherwise.
+ */
+int zephyrLedStripInitPacked(ZephyrLedStrip_t *strip, uint32_t pixelCnt,
+                             ZephyrLedPixelFormat_t format,
+                             ZephyrRgbPixel_t *xferBuf);
+
+/**
+ * @brief   Get the storage size of a pixel format.
+ *
+ * @param format    The pixel format.
+ *
+ * @return          The size of one pixel in bytes.
+ */
+size_t zephyrLedStripGetPixelSize(ZephyrLedPixelFormat_t format);
+
 /**
  * @brief   Get the pixel count of the LED strip.
  *
@@ -70,6 +144,42 @@ uint32_t zephyrLedStripGetPixelCnt(ZephyrLedStrip_t *strip);
 int zephyrLedStripSetPixel(ZephyrLedStrip_t *strip, uint32_t pixelIdx,
                            const ZephyrRgbPixel_t *rgbPixel);
 
+/**
+ * @brief   Get the desired pixel RGB color.
+ *
+ * @param strip     The LED strip data structure.
+ * @param pixelIdx  The index of the pixel to get the color.
+ * @param rgbPixel  The pixel RGB color.
+ *
+ * @return          0 if successful, the error code otherwise.
+*/
+int zephyrLedStripGetPixel(ZephyrLedStrip_t *strip, uint32_t pixelIdx,
+                           ZephyrRgbPixel_t *rgbPixel);
+
+/**
+ * @brief   Store a pixel in the strip storage format without any check. This
+ *          is the fast path of the renderers, the strip must be initialized
+ *          and the index in range.
+ *
+ * @param strip     The LED strip data structure to set.
+ * @param pixelIdx  The index of the pixel to set the color.
+ * @param rgbPixel  The pixel new RGB color.
+*/
+void zephyrLedStripStorePixel(ZephyrLedStrip_t *strip, uint32_t pixelIdx,
+                              const ZephyrRgbPixel_t *rgbPixel);
+
+/**
+ * @brief   Load a pixel from the strip storage format without any check. This
+ *          is the fast path of the renderers, the strip must be initialized
+ *          and the index in range.
+ *
+ * @param strip     The LED strip data structure.
+ * @param pixelIdx  The index of the pixel to get the color.
+ * @param rgbPixel  The pixel RGB color.
+*/
+void zephyrLedStripLoadPixel(ZephyrLedStrip_t *strip, uint32_t pixelIdx,
+                             ZephyrRgbPixel_t *rgbPixel);
+
 /**
  * @brief   Set the pixels included between the start and
  *
@@ -83,6 +193,72 @@ int zephyrLedStripSetPixel(ZephyrLedStrip_t *strip, uint32_t pixelIdx,
 int zephyrLedStripSetPixels(ZephyrLedStrip_t *strip, uint32_t start,
                             uint32_t end, const ZephyrRgbPixel_t *rgbPixels);
 
+#ifdef CONFIG_ENYA_LED_STRIP_DITHER
+/**
+ * @brief   Enable the temporal dithering of the strip. The pixels are then
+ *          kept with 16 bits per channel and each update emits an 8 bits
+ *          frame, carrying the truncation error of each channel to the next
+ *          frame. Only the native pixel format can be dithered.
+ *
+ * @param strip     The LED strip data structure.
+ *
+ * @return          0 if successful, the error code otherwise.
+ */
+int zephyrLedStripEnableDither(ZephyrLedStrip_t *strip);
+
+/**
+ * @brief   Set the desired pixel 16 bits per channel color. The strip
+ *          dithering must be enabled.
+ *
+ * @param strip     The LED strip data structure to set.
+ * @param pixelIdx  The index of the pixel to set the color.
+ * @param pixel     The pixel new 16 bits per channel color.
+ *
+ * @return          0 if successful, the error code otherwise.
+ */
+int zephyrLedStripSetPixel16(ZephyrLedStrip_t *strip, uint32_t pixelIdx,
+                             const ZephyrRgb16Pixel_t *pixel);
+
+/**
+ * @brief   Set the strip software brightness, applied with 16 bits precision
+ *          before the dithering. The strip dithering must be enabled.
+ *
+ * @param strip       The LED strip data structure.
+ * @param brightness  The brightness, 65535 being full brightness.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrLedStripSetBrightness(ZephyrLedStrip_t *strip, uint16_t brightness);
+#endif
+
+#ifdef CONFIG_ENYA_LED_STRIP_POWER_LIMIT
+/**
+ * @brief   Set the strip power limit. The channel sums are then updated on
+ *          each pixel write, and the update scales the sent frame down only
+ *          when its estimated current exceeds the budget. The strip frame
+ *          is never scaled, native format strips get a transfer buffer
+ *          allocated so the driver gets a copy of their frame.
+ *
+ * @param strip     The LED strip data structure.
+ * @param limit     The power limit configuration.
+ *
+ * @return          0 if successful, the error code otherwise.
+ */
+int zephyrLedStripSetPowerLimit(ZephyrLedStrip_t *strip,
+                                const ZephyrLedPowerLimit_t *limit);
+
+/**
+ * @brief   Get the estimated current of the current strip frame, with the
+ *          software brightness but before limiting. The strip power limit
+ *          must be set.
+ *
+ * @param strip     The LED strip data structure.
+ *
+ * @return          The estimated current in mA.
+ */
+uint32_t zephyrLedStripGetCurrentEstimate(ZephyrLedStrip_t *strip);
+#endif
+
 /**
  * @brief   Update the strip pixels.
  *
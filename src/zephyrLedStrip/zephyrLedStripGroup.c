@@ -0,0 +1,115 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrLedStripGroup.c
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     LED Strip Group Wrapper
+ *
+ *            This file is the implementation of the LED strip groups.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+#include "zephyrLedStripGroup.h"
+#include "zephyrCommon.h"
+
+LOG_MODULE_DECLARE(ZEPHYR_WRAPPER_MODULE_NAME);
+
+/**
+ * @brief   The member update work handler.
+ *
+ * @param item      The member update work.
+ */
+static void updateMember(struct k_work *item)
+{
+  ZephyrLedStripGroupMember_t *member =
+    CONTAINER_OF(item, ZephyrLedStripGroupMember_t, work.data);
+
+  member->rc = zephyrLedStripUpdate(member->strip);
+  k_sem_give(member->done);
+}
+
+int zephyrLedStripGroupInit(ZephyrLedStripGroup_t *group)
+{
+  if(group->memberCount == 0)
+  {
+    LOG_ERR("the LED strip group has no member");
+    return -EINVAL;
+  }
+
+  if(group->memberCount > 1 && (!group->queues || group->queueCount == 0))
+  {
+    LOG_ERR("the LED strip group has no update work queue");
+    return -EINVAL;
+  }
+
+  /* the members expand their packed pixels at the same time. */
+  for(size_t i = 0; i < group->memberCount; ++i)
+  {
+    for(size_t j = i + 1; j < group->memberCount; ++j)
+    {
+      if(group->members[i].strip->rgbPixels ==
+         group->members[j].strip->rgbPixels)
+      {
+        LOG_ERR("strips %zu and %zu share their transfer buffer", i, j);
+        return -EINVAL;
+      }
+    }
+  }
+
+  k_sem_init(&group->done, 0, group->memberCount);
+
+  for(size_t i = 0; i < group->memberCount; ++i)
+  {
+    group->members[i].work.handler = updateMember;
+    group->members[i].done = &group->done;
+    group->members[i].rc = 0;
+    zephyrWorkInit(&group->members[i].work);
+  }
+
+  return 0;
+}
+
+int zephyrLedStripGroupUpdate(ZephyrLedStripGroup_t *group)
+{
+  int rc;
+  size_t pendingCnt = 0;
+  ZephyrLedStripGroupMember_t *member;
+
+  for(size_t i = 1; i < group->memberCount; ++i)
+  {
+    member = group->members + i;
+    rc = zephyrWorkSubmitToQueue(group->queues + (i - 1) % group->queueCount,
+      &member->work);
+    if(rc < 0)
+    {
+      LOG_ERR("unable to submit the update of strip %zu", i);
+      member->rc = rc;
+    }
+    else
+      ++pendingCnt;
+  }
+
+  group->members[0].rc = zephyrLedStripUpdate(group->members[0].strip);
+
+  for(; pendingCnt > 0; --pendingCnt)
+    k_sem_take(&group->done, K_FOREVER);
+
+  for(size_t i = 0; i < group->memberCount; ++i)
+  {
+    if(group->members[i].rc < 0)
+    {
+      LOG_ERR("unable to update strip %zu", i);
+      return group->members[i].rc;
+    }
+  }
+
+  return 0;
+}
+
+/** @} */
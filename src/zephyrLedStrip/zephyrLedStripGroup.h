@@ -0,0 +1,76 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrLedStripGroup.h
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     LED Strip Group Wrapper
+ *
+ *            This file is the declaration of the LED strip groups. A group
+ *            updates several LED strip devices in parallel, each member
+ *            update running on one of the group work queues.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#ifndef LED_STRIP_GROUP_WRAPPER
+#define LED_STRIP_GROUP_WRAPPER
+
+#include <zephyr/kernel.h>
+
+#include "zephyrLedStrip.h"
+#include "zephyrWork.h"
+#include "zephyrWorkQueue.h"
+
+/**
+ * @brief   The LED strip group member data structure.
+*/
+typedef struct
+{
+  ZephyrLedStrip_t *strip;          /**< The member LED strip. */
+  ZephyrWork_t work;                /**< The member update work. */
+  struct k_sem *done;               /**< The group update done semaphore. */
+  int rc;                           /**< The last update result. */
+} ZephyrLedStripGroupMember_t;
+
+/**
+ * @brief   The LED strip group data structure.
+*/
+typedef struct
+{
+  ZephyrLedStripGroupMember_t *members;   /**< The group members. */
+  size_t memberCount;                     /**< The group member count. */
+  ZephyrWorkQueue_t *queues;              /**< The started update work queues. */
+  size_t queueCount;                      /**< The update work queue count. */
+  struct k_sem done;                      /**< The update done semaphore. */
+} ZephyrLedStripGroup_t;
+
+/**
+ * @brief   Initialize a LED strip group. The members strip, the work queues
+ *          and their counts must be set before calling this. The work queues
+ *          must be started by the caller. The members are updated in parallel
+ *          so they cannot share a packed pixels transfer buffer.
+ *
+ * @param group     The group to initialize.
+ *
+ * @return          0 if successful, the error code otherwise.
+ */
+int zephyrLedStripGroupInit(ZephyrLedStripGroup_t *group);
+
+/**
+ * @brief   Update all the group strips. The first member is updated in the
+ *          calling thread while the others are updated in parallel on the
+ *          group work queues. The function returns once all the strips are
+ *          updated.
+ *
+ * @param group     The group to update.
+ *
+ * @return          0 if successful, the error code of the first failing
+ *                  member otherwise.
+ */
+int zephyrLedStripGroupUpdate(ZephyrLedStripGroup_t *group);
+
+#endif    /* LED_STRIP_GROUP_WRAPPER */
+
+/** @} */
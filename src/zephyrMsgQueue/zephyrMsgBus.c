@@ -0,0 +1,204 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrMsgBus.c
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Message Bus Wrapper
+ *
+ *            This file is the implementation of the publish/subscribe message
+ *            bus.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+#include "zephyrMsgBus.h"
+
+LOG_MODULE_DECLARE(ZEPHYR_WRAPPER_MODULE_NAME);
+
+/**
+ * @brief   Get the header of a message.
+ *
+ * @param msg         The message.
+ *
+ * @return            The message header.
+ */
+static inline ZephyrMsgBusHeader_t *getHeader(const void *msg)
+{
+  return (ZephyrMsgBusHeader_t *)msg - 1;
+}
+
+/**
+ * @brief   Deliver a message to a subscriber, applying its drop policy.
+ *
+ * @param sub         The subscriber.
+ * @param msg         The message.
+ *
+ * @return            true if the message was delivered, false otherwise.
+ */
+static bool deliverMessage(ZephyrMsgBusSub_t *sub, void *msg)
+{
+  void *dropped;
+
+  /* the subscriber reference is taken before the message is visible. */
+  atomic_inc(&getHeader(msg)->refCnt);
+
+  if(sub->policy == MSG_BUS_DROP_OLDEST)
+  {
+    if(zephyrMsgQueuePushOverwrite(&sub->queue, &msg, &dropped) > 0)
+    {
+      atomic_inc(&sub->dropCnt);
+      zephyrMsgBusRelease(sub->bus, dropped);
+    }
+    return true;
+  }
+
+  if(zephyrMsgQueuePush(&sub->queue, &msg, ZEPHYR_TIME_NO_WAIT, MILLI_SEC) < 0)
+  {
+    atomic_inc(&sub->dropCnt);
+    atomic_dec(&getHeader(msg)->refCnt);
+    return false;
+  }
+
+  return true;
+}
+
+int zephyrMsgBusInit(ZephyrMsgBus_t *bus, char *buffer, size_t msgSize,
+                     size_t maxMsgCnt)
+{
+  int rc;
+
+  if(!buffer || !IS_ALIGNED(buffer, sizeof(void *)))
+  {
+    LOG_ERR("invalid message bus pool");
+    return -EINVAL;
+  }
+
+  rc = k_mem_slab_init(&bus->pool, buffer, ZEPHYR_MSG_BUS_BLOCK_SIZE(msgSize),
+    maxMsgCnt);
+  if(rc < 0)
+  {
+    LOG_ERR("unable to initialize the message bus pool");
+    return rc;
+  }
+
+  sys_slist_init(&bus->subscribers);
+  k_mutex_init(&bus->lock);
+
+  return 0;
+}
+
+int zephyrMsgBusSubscribe(ZephyrMsgBus_t *bus, ZephyrMsgBusSub_t *sub,
+                          char *buffer, size_t depth, uint32_t topics,
+                          ZephyrMsgBusDrop_t policy)
+{
+  int rc;
+
+  rc = zephyrMsgQueueInitStatic(&sub->queue, buffer, sizeof(void *), depth);
+  if(rc < 0)
+  {
+    LOG_ERR("unable to initialize the subscriber queue");
+    return rc;
+  }
+
+  sub->bus = bus;
+  sub->topics = topics;
+  sub->policy = policy;
+  atomic_clear(&sub->dropCnt);
+
+  k_mutex_lock(&bus->lock, K_FOREVER);
+  sys_slist_append(&bus->subscribers, &sub->node);
+  k_mutex_unlock(&bus->lock);
+
+  return 0;
+}
+
+void zephyrMsgBusUnsubscribe(ZephyrMsgBusSub_t *sub)
+{
+  void *msg;
+
+  k_mutex_lock(&sub->bus->lock, K_FOREVER);
+  sys_slist_find_and_remove(&sub->bus->subscribers, &sub->node);
+  k_mutex_unlock(&sub->bus->lock);
+
+  while(zephyrMsgQueuePop(&sub->queue, &msg, ZEPHYR_TIME_NO_WAIT,
+                          MILLI_SEC) == 0)
+    zephyrMsgBusRelease(sub->bus, msg);
+}
+
+int zephyrMsgBusAlloc(ZephyrMsgBus_t *bus, void **msg, uint32_t timeout,
+                      ZephyrTimeUnit_t timeUnit)
+{
+  int rc;
+  ZephyrMsgBusHeader_t *header;
+
+  rc = k_mem_slab_alloc(&bus->pool, (void **)&header,
+    zephyrCommonProcessTimeout(timeout, timeUnit));
+  if(rc < 0)
+    return rc;
+
+  /* the publisher holds the first reference until the message is out. */
+  atomic_set(&header->refCnt, 1);
+  *msg = header + 1;
+
+  return 0;
+}
+
+int zephyrMsgBusPublish(ZephyrMsgBus_t *bus, void *msg, uint8_t topic)
+{
+  int deliveredCnt = 0;
+  ZephyrMsgBusSub_t *sub;
+
+  if(topic >= 32)
+  {
+    LOG_ERR("invalid message bus topic %d", topic);
+    zephyrMsgBusRelease(bus, msg);
+    return -EINVAL;
+  }
+
+  getHeader(msg)->topic = topic;
+
+  k_mutex_lock(&bus->lock, K_FOREVER);
+
+  SYS_SLIST_FOR_EACH_CONTAINER(&bus->subscribers, sub, node)
+  {
+    if((sub->topics & BIT(topic)) && deliverMessage(sub, msg))
+      ++deliveredCnt;
+  }
+
+  k_mutex_unlock(&bus->lock);
+
+  zephyrMsgBusRelease(bus, msg);
+
+  return deliveredCnt;
+}
+
+int zephyrMsgBusReceive(ZephyrMsgBusSub_t *sub, void **msg, uint32_t timeout,
+                        ZephyrTimeUnit_t timeUnit)
+{
+  return zephyrMsgQueuePop(&sub->queue, msg, timeout, timeUnit);
+}
+
+void zephyrMsgBusRelease(ZephyrMsgBus_t *bus, void *msg)
+{
+  ZephyrMsgBusHeader_t *header = getHeader(msg);
+
+  if(atomic_dec(&header->refCnt) == 1)
+    k_mem_slab_free(&bus->pool, header);
+}
+
+uint8_t zephyrMsgBusGetTopic(const void *msg)
+{
+  return getHeader(msg)->topic;
+}
+
+uint32_t zephyrMsgBusGetDropCount(ZephyrMsgBusSub_t *sub)
+{
+  return atomic_get(&sub->dropCnt);
+}
+
+/** @} */
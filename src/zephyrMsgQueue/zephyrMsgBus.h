@@ -0,0 +1,206 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrMsgBus.h
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Message Bus Wrapper
+ *
+ *            This file is the declaration of the publish/subscribe message
+ *            bus. A message is published once in a reference counted block
+ *            of the bus pool and each subscriber of its topic only receives
+ *            a pointer to it. The block returns to the pool when the last
+ *            subscriber releases it.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#ifndef MESSAGE_BUS_WRAPPER
+#define MESSAGE_BUS_WRAPPER
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/slist.h>
+
+#include "zephyrCommon.h"
+#include "zephyrMsgQueue.h"
+
+/**
+ * @brief   The bus message header, placed before each message payload.
+ */
+typedef struct
+{
+  atomic_t refCnt;                  /**< The message reference count. */
+  uint32_t topic;                   /**< The message topic. */
+} ZephyrMsgBusHeader_t;
+
+/**
+ * @brief   Get the bus pool block size of a message size.
+ *
+ * @param _msgSize    The message size.
+ */
+#define ZEPHYR_MSG_BUS_BLOCK_SIZE(_msgSize)                                   \
+  ROUND_UP(sizeof(ZephyrMsgBusHeader_t) + (_msgSize), sizeof(void *))
+
+/**
+ * @brief   Define a message bus pool buffer, sized and aligned at build time.
+ *          The buffer is local to the defining file.
+ *
+ * @param _name       The buffer name.
+ * @param _msgSize    The message size of the bus.
+ * @param _maxMsgCnt  The maximum count of messages in flight.
+ */
+#define ZEPHYR_MSG_BUS_BUFFER_DEFINE(_name, _msgSize, _maxMsgCnt)             \
+  static char __aligned(sizeof(void *))                                       \
+    _name[ZEPHYR_MSG_BUS_BLOCK_SIZE(_msgSize) * (_maxMsgCnt)]
+
+/**
+ * @brief   Define a subscriber queue buffer, sized and aligned at build time.
+ *          The buffer is local to the defining file.
+ *
+ * @param _name       The buffer name.
+ * @param _depth      The maximum count of messages pending in the subscriber.
+ */
+#define ZEPHYR_MSG_BUS_SUB_BUFFER_DEFINE(_name, _depth)                       \
+  static ZEPHYR_MSG_QUEUE_BUFFER_DEFINE(_name, sizeof(void *), _depth)
+
+/**
+ * @brief   The subscriber drop policies, applied when its queue is full.
+ */
+typedef enum
+{
+  MSG_BUS_DROP_NEWEST,              /**< Drop the message being published. */
+  MSG_BUS_DROP_OLDEST,              /**< Drop the oldest pending message. */
+} ZephyrMsgBusDrop_t;
+
+/**
+ * @brief   The message bus data structure.
+ */
+typedef struct
+{
+  struct k_mem_slab pool;           /**< The message block pool. */
+  sys_slist_t subscribers;          /**< The subscriber list. */
+  struct k_mutex lock;              /**< The subscriber list lock. */
+} ZephyrMsgBus_t;
+
+/**
+ * @brief   The message bus subscriber data structure.
+ */
+typedef struct
+{
+  sys_snode_t node;                 /**< The subscriber list node. */
+  ZephyrMsgBus_t *bus;              /**< The subscribed bus. */
+  ZephyrMsgQueue_t queue;           /**< The pending message pointer queue. */
+  uint32_t topics;                  /**< The subscribed topic bitmask. */
+  ZephyrMsgBusDrop_t policy;        /**< The drop policy. */
+  atomic_t dropCnt;                 /**< The dropped message count. */
+} ZephyrMsgBusSub_t;
+
+/**
+ * @brief   Initialize a message bus.
+ *
+ * @param bus         The message bus.
+ * @param buffer      The pool buffer, usually defined with
+ *                    ZEPHYR_MSG_BUS_BUFFER_DEFINE.
+ * @param msgSize     The message size.
+ * @param maxMsgCnt   The maximum count of messages in flight.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrMsgBusInit(ZephyrMsgBus_t *bus, char *buffer, size_t msgSize,
+                     size_t maxMsgCnt);
+
+/**
+ * @brief   Subscribe to topics of a message bus.
+ *
+ * @param bus         The message bus.
+ * @param sub         The subscriber.
+ * @param buffer      The subscriber queue buffer, usually defined with
+ *                    ZEPHYR_MSG_BUS_SUB_BUFFER_DEFINE.
+ * @param depth       The maximum count of messages pending in the subscriber.
+ * @param topics      The subscribed topic bitmask, BIT(topic) for each topic.
+ * @param policy      The drop policy when the subscriber queue is full.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrMsgBusSubscribe(ZephyrMsgBus_t *bus, ZephyrMsgBusSub_t *sub,
+                          char *buffer, size_t depth, uint32_t topics,
+                          ZephyrMsgBusDrop_t policy);
+
+/**
+ * @brief   Unsubscribe from a message bus, releasing the pending messages.
+ *
+ * @param sub         The subscriber.
+ */
+void zephyrMsgBusUnsubscribe(ZephyrMsgBusSub_t *sub);
+
+/**
+ * @brief   Allocate a message to fill in place before publishing it.
+ *
+ * @param bus         The message bus.
+ * @param msg         The allocated message.
+ * @param timeout     The waiting period if the pool is exhausted.
+ * @param timeUnit    The time unit of the timeout.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrMsgBusAlloc(ZephyrMsgBus_t *bus, void **msg, uint32_t timeout,
+                      ZephyrTimeUnit_t timeUnit);
+
+/**
+ * @brief   Publish an allocated message to the subscribers of a topic. The
+ *          message belongs to the bus once published.
+ *
+ * @param bus         The message bus.
+ * @param msg         The message.
+ * @param topic       The message topic, from 0 to 31.
+ *
+ * @return            The count of subscribers the message was delivered to if
+ *                    successful, the error code otherwise.
+ */
+int zephyrMsgBusPublish(ZephyrMsgBus_t *bus, void *msg, uint8_t topic);
+
+/**
+ * @brief   Receive a message. The message must be released once used.
+ *
+ * @param sub         The subscriber.
+ * @param msg         The received message.
+ * @param timeout     The waiting period if no message is pending.
+ * @param timeUnit    The time unit of the timeout.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrMsgBusReceive(ZephyrMsgBusSub_t *sub, void **msg, uint32_t timeout,
+                        ZephyrTimeUnit_t timeUnit);
+
+/**
+ * @brief   Release a received message, or an allocated message that will not
+ *          be published.
+ *
+ * @param bus         The message bus.
+ * @param msg         The message.
+ */
+void zephyrMsgBusRelease(ZephyrMsgBus_t *bus, void *msg);
+
+/**
+ * @brief   Get the topic of a message.
+ *
+ * @param msg         The message.
+ *
+ * @return            The message topic.
+ */
+uint8_t zephyrMsgBusGetTopic(const void *msg);
+
+/**
+ * @brief   Get the count of messages dropped by a subscriber.
+ *
+ * @param sub         The subscriber.
+ *
+ * @return            The dropped message count.
+ */
+uint32_t zephyrMsgBusGetDropCount(ZephyrMsgBusSub_t *sub);
+
+#endif    /* MESSAGE_BUS_WRAPPER */
+
+/** @} */
@@ -19,6 +19,166 @@
 
 LOG_MODULE_DECLARE(ZEPHYR_WRAPPER_MODULE_NAME);
 
+/**
+ * @brief   Copy messages to the queue ring, splitting the copy at the wrap.
+ *          The queue lock must be held.
+ *
+ * @param msgq        The zephyr message queue.
+ * @param msgs        The messages to copy.
+ * @param msgCnt      The message count to copy.
+ */
+static void copyToRing(struct k_msgq *msgq, const char *msgs, size_t msgCnt)
+{
+  size_t size = msgCnt * msgq->msg_size;
+  size_t chunk = MIN(size, (size_t)(msgq->buffer_end - msgq->write_ptr));
+
+  memcpy(msgq->write_ptr, msgs, chunk);
+  memcpy(msgq->buffer_start, msgs + chunk, size - chunk);
+
+  msgq->write_ptr += size;
+  if(msgq->write_ptr >= msgq->buffer_end)
+    msgq->write_ptr -= msgq->buffer_end - msgq->buffer_start;
+  msgq->used_msgs += msgCnt;
+}
+
+/**
+ * @brief   Copy messages from the queue ring, splitting the copy at the wrap.
+ *          The queue lock must be held.
+ *
+ * @param msgq        The zephyr message queue.
+ * @param msgs        The copied messages.
+ * @param msgCnt      The message count to copy.
+ */
+static void copyFromRing(struct k_msgq *msgq, char *msgs, size_t msgCnt)
+{
+  size_t size = msgCnt * msgq->msg_size;
+  size_t chunk = MIN(size, (size_t)(msgq->buffer_end - msgq->read_ptr));
+
+  memcpy(msgs, msgq->read_ptr, chunk);
+  memcpy(msgs + chunk, msgq->buffer_start, size - chunk);
+
+  msgq->read_ptr += size;
+  if(msgq->read_ptr >= msgq->buffer_end)
+    msgq->read_ptr -= msgq->buffer_end - msgq->buffer_start;
+  msgq->used_msgs -= msgCnt;
+}
+
+#ifdef CONFIG_ENYA_MSG_QUEUE_STATS
+/**
+ * @brief   The registered queues.
+ */
+static sys_slist_t registeredQueues = SYS_SLIST_STATIC_INIT(&registeredQueues);
+
+/**
+ * @brief   The registered queues lock.
+ */
+static K_MUTEX_DEFINE(registryLock);
+
+/**
+ * @brief   Start timing a queue operation. The 32 bits cycle counter wraps
+ *          within seconds on fast cores, so the 64 bits cycle counter is
+ *          used when available and the 64 bits tick count otherwise.
+ *
+ * @return            The operation start time stamp.
+ */
+static inline uint64_t statsStart(void)
+{
+#ifdef CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER
+  return k_cycle_get_64();
+#else
+  return k_uptime_ticks();
+#endif
+}
+
+/**
+ * @brief   Get the time a queue operation was allowed to wait.
+ *
+ * @param wait        The operation timeout.
+ * @param start       The operation start time stamp.
+ *
+ * @return            The elapsed time (us), saturated, 0 if the operation
+ *                    could not wait.
+ */
+static inline uint32_t statsElapsed(k_timeout_t wait, uint64_t start)
+{
+  uint64_t elapsedUs;
+
+  if(K_TIMEOUT_EQ(wait, K_NO_WAIT))
+    return 0;
+
+#ifdef CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER
+  elapsedUs = k_cyc_to_us_floor64(k_cycle_get_64() - start);
+#else
+  elapsedUs = k_ticks_to_us_floor64(k_uptime_ticks() - start);
+#endif
+
+  return MIN(elapsedUs, UINT32_MAX);
+}
+
+/**
+ * @brief   Record a push operation in the queue statistics.
+ *
+ * @param queue       The zephyr message queue.
+ * @param waitUs      The producer wait time (us).
+ * @param pushedCnt   The pushed message count, 0 if the push failed.
+ */
+static void recordPush(ZephyrMsgQueue_t *queue, uint32_t waitUs,
+                       size_t pushedCnt)
+{
+  ZephyrMsgQueueStats_t *stats = &queue->stats;
+  k_spinlock_key_t key = k_spin_lock(&queue->msgq.lock);
+
+  if(pushedCnt == 0)
+    ++stats->pushFailCnt;
+  stats->pushCnt += pushedCnt;
+  stats->peakMsgCnt = MAX(stats->peakMsgCnt, queue->msgq.used_msgs);
+  stats->pushWaitTotal += waitUs;
+  stats->pushWaitMax = MAX(stats->pushWaitMax, waitUs);
+
+  k_spin_unlock(&queue->msgq.lock, key);
+}
+
+/**
+ * @brief   Record a pop operation in the queue statistics.
+ *
+ * @param queue       The zephyr message queue.
+ * @param waitUs      The consumer wait time (us).
+ * @param poppedCnt   The popped message count.
+ */
+static void recordPop(ZephyrMsgQueue_t *queue, uint32_t waitUs,
+                      size_t poppedCnt)
+{
+  ZephyrMsgQueueStats_t *stats = &queue->stats;
+  k_spinlock_key_t key = k_spin_lock(&queue->msgq.lock);
+
+  stats->popCnt += poppedCnt;
+  stats->popWaitTotal += waitUs;
+  stats->popWaitMax = MAX(stats->popWaitMax, waitUs);
+
+  k_spin_unlock(&queue->msgq.lock, key);
+}
+#else
+static inline uint64_t statsStart(void)
+{
+  return 0;
+}
+
+static inline uint32_t statsElapsed(k_timeout_t wait, uint64_t start)
+{
+  return 0;
+}
+
+static inline void recordPush(ZephyrMsgQueue_t *queue, uint32_t waitUs,
+                              size_t pushedCnt)
+{
+}
+
+static inline void recordPop(ZephyrMsgQueue_t *queue, uint32_t waitUs,
+                             size_t poppedCnt)
+{
+}
+#endif
+
 int zephyrMsgQueueInit(ZephyrMsgQueue_t *queue, size_t msgSize, size_t maxMsgCnt)
 {
   queue->buffer = k_malloc(msgSize * maxMsgCnt);
@@ -26,6 +186,34 @@ int zephyrMsgQueueInit(ZephyrMsgQueue_t *queue, size_t msgSize, size_t maxMsgCnt
     return -ENOSPC;
 
   k_msgq_init(&queue->msgq, queue->buffer, msgSize, maxMsgCnt);
+  queue->overwrite = false;
+  queue->dropCnt = 0;
+#ifdef CONFIG_ENYA_MSG_QUEUE_STATS
+  memset(&queue->stats, 0, sizeof(queue->stats));
+#endif
+
+  return 0;
+}
+
+int zephyrMsgQueueInitStatic(ZephyrMsgQueue_t *queue, char *buffer,
+                             size_t msgSize, size_t maxMsgCnt)
+{
+  /* the largest power of 2 dividing the message size. */
+  size_t align = MIN(msgSize & -msgSize, ZEPHYR_MSG_QUEUE_ALIGN);
+
+  if(!buffer || msgSize == 0 || !IS_ALIGNED(buffer, align))
+  {
+    LOG_ERR("invalid message queue storage");
+    return -EINVAL;
+  }
+
+  queue->buffer = buffer;
+  k_msgq_init(&queue->msgq, queue->buffer, msgSize, maxMsgCnt);
+  queue->overwrite = false;
+  queue->dropCnt = 0;
+#ifdef CONFIG_ENYA_MSG_QUEUE_STATS
+  memset(&queue->stats, 0, sizeof(queue->stats));
+#endif
 
   return 0;
 }
@@ -33,15 +221,197 @@ int zephyrMsgQueueInit(ZephyrMsgQueue_t *queue, size_t msgSize, size_t maxMsgCnt
 int zephyrMsgQueuePush(ZephyrMsgQueue_t *queue, const void *msg,
                        uint32_t timeout, ZephyrTimeUnit_t timeUnit)
 {
-  return k_msgq_put(&queue->msgq, msg,
-    zephyrCommonProcessTimeout(timeout, timeUnit));
+  int rc;
+  uint64_t start = statsStart();
+  k_timeout_t wait = zephyrCommonProcessTimeout(timeout, timeUnit);
+
+  if(queue->overwrite)
+  {
+    zephyrMsgQueuePushOverwrite(queue, msg, NULL);
+    return 0;
+  }
+
+  rc = k_msgq_put(&queue->msgq, msg, wait);
+  recordPush(queue, statsElapsed(wait, start), rc < 0 ? 0 : 1);
+
+  return rc;
 }
 
 int zephyrMsgQueuePop(ZephyrMsgQueue_t *queue, void *msg,
                       uint32_t timeout, ZephyrTimeUnit_t timeUnit)
 {
-  return k_msgq_get(&queue->msgq, msg,
-    zephyrCommonProcessTimeout(timeout, timeUnit));
+  int rc;
+  uint64_t start = statsStart();
+  k_timeout_t wait = zephyrCommonProcessTimeout(timeout, timeUnit);
+
+  rc = k_msgq_get(&queue->msgq, msg, wait);
+  recordPop(queue, statsElapsed(wait, start), rc < 0 ? 0 : 1);
+
+  return rc;
+}
+
+int zephyrMsgQueuePushOverwrite(ZephyrMsgQueue_t *queue, const void *msg,
+                                void *dropped)
+{
+  k_spinlock_key_t key;
+  struct k_msgq *msgq = &queue->msgq;
+
+  for(;;)
+  {
+    if(k_msgq_put(msgq, msg, K_NO_WAIT) == 0)
+    {
+      recordPush(queue, 0, 1);
+      return 0;
+    }
+
+    key = k_spin_lock(&msgq->lock);
+
+    /* a full queue has no reader waiting, the oldest message is replaced
+     * in place. Otherwise, a reader made room since the put, retry it. */
+    if(msgq->used_msgs == msgq->max_msgs)
+    {
+      if(dropped)
+        memcpy(dropped, msgq->read_ptr, msgq->msg_size);
+
+      msgq->read_ptr += msgq->msg_size;
+      if(msgq->read_ptr == msgq->buffer_end)
+        msgq->read_ptr = msgq->buffer_start;
+      --msgq->used_msgs;
+
+      copyToRing(msgq, msg, 1);
+      ++queue->dropCnt;
+
+      k_spin_unlock(&msgq->lock, key);
+
+      recordPush(queue, 0, 1);
+      return 1;
+    }
+
+    k_spin_unlock(&msgq->lock, key);
+  }
+}
+
+void zephyrMsgQueueSetOverwrite(ZephyrMsgQueue_t *queue, bool overwrite)
+{
+  queue->overwrite = overwrite;
+}
+
+uint32_t zephyrMsgQueueGetDropCount(ZephyrMsgQueue_t *queue)
+{
+  return queue->dropCnt;
+}
+
+int zephyrMsgQueuePushMany(ZephyrMsgQueue_t *queue, const void *msgs,
+                           size_t msgCnt, uint32_t timeout,
+                           ZephyrTimeUnit_t timeUnit)
+{
+  int rc;
+  size_t pushedCnt = 0;
+  size_t batchCnt;
+  k_spinlock_key_t key;
+  uint32_t waitUs;
+  const char *msg = msgs;
+  struct k_msgq *msgq = &queue->msgq;
+  uint64_t start = statsStart();
+  k_timeout_t wait = zephyrCommonProcessTimeout(timeout, timeUnit);
+
+  if(msgCnt == 0)
+    return 0;
+
+  if(queue->overwrite)
+  {
+    for(; pushedCnt < msgCnt; ++pushedCnt)
+      zephyrMsgQueuePushOverwrite(queue, msg + pushedCnt * msgq->msg_size,
+        NULL);
+    return pushedCnt;
+  }
+
+  rc = k_msgq_put(msgq, msg, wait);
+  waitUs = statsElapsed(wait, start);
+  if(rc < 0)
+  {
+    recordPush(queue, waitUs, 0);
+    return rc;
+  }
+  ++pushedCnt;
+
+  while(pushedCnt < msgCnt)
+  {
+    key = k_spin_lock(&msgq->lock);
+
+    /* a non-empty queue has no reader waiting, the ring can be filled
+     * directly. Otherwise, k_msgq_put() hands the message to the reader. */
+    if(msgq->used_msgs > 0)
+    {
+      batchCnt = MIN(msgCnt - pushedCnt, msgq->max_msgs - msgq->used_msgs);
+      copyToRing(msgq, msg + pushedCnt * msgq->msg_size, batchCnt);
+      pushedCnt += batchCnt;
+      k_spin_unlock(&msgq->lock, key);
+      break;
+    }
+
+    k_spin_unlock(&msgq->lock, key);
+
+    if(k_msgq_put(msgq, msg + pushedCnt * msgq->msg_size, K_NO_WAIT) < 0)
+      break;
+    ++pushedCnt;
+  }
+
+  recordPush(queue, waitUs, pushedCnt);
+
+  return pushedCnt;
+}
+
+int zephyrMsgQueuePopMany(ZephyrMsgQueue_t *queue, void *msgs, size_t msgCnt,
+                          uint32_t timeout, ZephyrTimeUnit_t timeUnit)
+{
+  int rc;
+  size_t poppedCnt = 0;
+  size_t batchCnt;
+  k_spinlock_key_t key;
+  uint32_t waitUs;
+  char *msg = msgs;
+  struct k_msgq *msgq = &queue->msgq;
+  uint64_t start = statsStart();
+  k_timeout_t wait = zephyrCommonProcessTimeout(timeout, timeUnit);
+
+  if(msgCnt == 0)
+    return 0;
+
+  rc = k_msgq_get(msgq, msg, wait);
+  waitUs = statsElapsed(wait, start);
+  if(rc < 0)
+  {
+    recordPop(queue, waitUs, 0);
+    return rc;
+  }
+  ++poppedCnt;
+
+  while(poppedCnt < msgCnt)
+  {
+    key = k_spin_lock(&msgq->lock);
+
+    /* a non-full queue has no writer waiting, the ring can be drained
+     * directly. Otherwise, k_msgq_get() refills it from the writer. */
+    if(msgq->used_msgs < msgq->max_msgs)
+    {
+      batchCnt = MIN(msgCnt - poppedCnt, msgq->used_msgs);
+      copyFromRing(msgq, msg + poppedCnt * msgq->msg_size, batchCnt);
+      poppedCnt += batchCnt;
+      k_spin_unlock(&msgq->lock, key);
+      break;
+    }
+
+    k_spin_unlock(&msgq->lock, key);
+
+    if(k_msgq_get(msgq, msg + poppedCnt * msgq->msg_size, K_NO_WAIT) < 0)
+      break;
+    ++poppedCnt;
+  }
+
+  recordPop(queue, waitUs, poppedCnt);
+
+  return poppedCnt;
 }
 
 int zephyrMsgQueuePeek(ZephyrMsgQueue_t *queue, void *msg)
@@ -49,6 +419,38 @@ int zephyrMsgQueuePeek(ZephyrMsgQueue_t *queue, void *msg)
   return k_msgq_peek(&queue->msgq, msg);
 }
 
+int zephyrMsgQueueReplace(ZephyrMsgQueue_t *queue, const void *msg,
+                          const void *newMsg)
+{
+  int rc = -ENOENT;
+  char *slot;
+  k_spinlock_key_t key;
+  struct k_msgq *msgq = &queue->msgq;
+
+  /* only the slot content changes, the msgq indexes, count and waiters are
+   * left to the k_msgq API. */
+  key = k_spin_lock(&msgq->lock);
+
+  slot = msgq->read_ptr;
+  for(uint32_t i = 0; i < msgq->used_msgs; ++i)
+  {
+    if(memcmp(slot, msg, msgq->msg_size) == 0)
+    {
+      memcpy(slot, newMsg, msgq->msg_size);
+      rc = 0;
+      break;
+    }
+
+    slot += msgq->msg_size;
+    if(slot == msgq->buffer_end)
+      slot = msgq->buffer_start;
+  }
+
+  k_spin_unlock(&msgq->lock, key);
+
+  return rc;
+}
+
 void zephyrMsgQueuePurge(ZephyrMsgQueue_t *queue)
 {
   k_msgq_purge(&queue->msgq);
@@ -64,5 +466,52 @@ size_t zephyrMsgQueueGetMsgCount(ZephyrMsgQueue_t *queue)
   return k_msgq_num_used_get(&queue->msgq);
 }
 
+#ifdef CONFIG_ENYA_MSG_QUEUE_STATS
+void zephyrMsgQueueRegister(ZephyrMsgQueue_t *queue, const char *name)
+{
+  queue->name = name;
+
+  k_mutex_lock(&registryLock, K_FOREVER);
+  sys_slist_append(&registeredQueues, &queue->node);
+  k_mutex_unlock(&registryLock);
+}
+
+void zephyrMsgQueueGetStats(ZephyrMsgQueue_t *queue,
+                            ZephyrMsgQueueStats_t *stats)
+{
+  k_spinlock_key_t key = k_spin_lock(&queue->msgq.lock);
+
+  *stats = queue->stats;
+
+  k_spin_unlock(&queue->msgq.lock, key);
+}
+
+void zephyrMsgQueueResetStats(ZephyrMsgQueue_t *queue)
+{
+  k_spinlock_key_t key = k_spin_lock(&queue->msgq.lock);
+
+  memset(&queue->stats, 0, sizeof(queue->stats));
+  queue->stats.peakMsgCnt = queue->msgq.used_msgs;
+
+  k_spin_unlock(&queue->msgq.lock, key);
+}
+
+void zephyrMsgQueueForEach(ZephyrMsgQueueStatsCb_t callback, void *userData)
+{
+  ZephyrMsgQueue_t *queue;
+  ZephyrMsgQueueStats_t stats;
+
+  k_mutex_lock(&registryLock, K_FOREVER);
+
+  SYS_SLIST_FOR_EACH_CONTAINER(&registeredQueues, queue, node)
+  {
+    zephyrMsgQueueGetStats(queue, &stats);
+    callback(queue, queue->name, &stats, userData);
+  }
+
+  k_mutex_unlock(&registryLock);
+}
+#endif
+
 
 /** @} */
@@ -15,10 +15,74 @@
 #ifndef MESSAGE_QUEUE_WRAPPER
 #define MESSAGE_QUEUE_WRAPPER
 
+#include <zephyr/init.h>
 #include <zephyr/kernel.h>
+#include <zephyr/sys/slist.h>
 
 #include "zephyrCommon.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   The message queue buffer alignment.
+ */
+#define ZEPHYR_MSG_QUEUE_ALIGN      4
+
+/**
+ * @brief   Define a message queue storage buffer, sized and aligned at
+ *          build time.
+ *
+ * @param _name       The buffer name.
+ * @param _msgSize    The message size of the queue.
+ * @param _maxMsgCnt  The maximum message count in the queue.
+ */
+#define ZEPHYR_MSG_QUEUE_BUFFER_DEFINE(_name, _msgSize, _maxMsgCnt)           \
+  char __aligned(ZEPHYR_MSG_QUEUE_ALIGN) _name[(_msgSize) * (_maxMsgCnt)]
+
+/**
+ * @brief   Define a message queue with its storage at build time. The queue
+ *          is initialized through the public k_msgq API at the start of the
+ *          PRE_KERNEL_2 init level, strictly after the kernel set up the
+ *          message queue objects, so it is registered for the object
+ *          tracing. It is ready to use from the PRE_KERNEL_2 drivers init
+ *          onward. Being embedded in another structure, the queue can
+ *          neither be placed with the K_MSGQ_DEFINE queues nor be granted to
+ *          user mode threads.
+ *
+ * @param _name       The message queue name.
+ * @param _msgSize    The message size of the queue.
+ * @param _maxMsgCnt  The maximum message count in the queue.
+ */
+#define ZEPHYR_MSG_QUEUE_DEFINE(_name, _msgSize, _maxMsgCnt)                  \
+  static ZEPHYR_MSG_QUEUE_BUFFER_DEFINE(_name##Buffer, _msgSize, _maxMsgCnt); \
+  ZephyrMsgQueue_t _name;                                                     \
+  static int _name##Init(void)                                                \
+  {                                                                           \
+    return zephyrMsgQueueInitStatic(&_name, _name##Buffer, _msgSize,          \
+                                    _maxMsgCnt);                              \
+  }                                                                           \
+  SYS_INIT(_name##Init, PRE_KERNEL_2, 0)
+
+#ifdef CONFIG_ENYA_MSG_QUEUE_STATS
+/**
+ * @brief   The message queue statistics. The wait times are in microseconds
+ *          and only count the calls allowed to wait.
+ */
+typedef struct
+{
+  uint32_t peakMsgCnt;              /**< The peak message count. */
+  uint32_t pushCnt;                 /**< The pushed message count. */
+  uint32_t popCnt;                  /**< The popped message count. */
+  uint32_t pushFailCnt;             /**< The failed push count. */
+  uint64_t pushWaitTotal;           /**< The cumulative producer wait time. */
+  uint32_t pushWaitMax;             /**< The maximum producer wait time. */
+  uint64_t popWaitTotal;            /**< The cumulative consumer wait time. */
+  uint32_t popWaitMax;              /**< The maximum consumer wait time. */
+} ZephyrMsgQueueStats_t;
+#endif
+
 /**
  * Zephyr message queue data structure.
  */
@@ -26,8 +90,30 @@ typedef struct
 {
   struct k_msgq msgq;               /**< The zephyr message queue structure. */
   char *buffer;                     /**< The message queue buffer. */
+  bool overwrite;                   /**< The overwrite oldest mode flag. */
+  uint32_t dropCnt;                 /**< The overwritten message count. */
+#ifdef CONFIG_ENYA_MSG_QUEUE_STATS
+  ZephyrMsgQueueStats_t stats;      /**< The queue statistics. */
+  const char *name;                 /**< The registered queue name. */
+  sys_snode_t node;                 /**< The registered queue list node. */
+#endif
 } ZephyrMsgQueue_t;
 
+#ifdef CONFIG_ENYA_MSG_QUEUE_STATS
+/**
+ * @brief   The registered queue iteration callback.
+ *
+ * @param queue       The message queue.
+ * @param name        The queue name.
+ * @param stats       The snapshot of the queue statistics.
+ * @param userData    The iteration user data.
+ */
+typedef void (*ZephyrMsgQueueStatsCb_t)(ZephyrMsgQueue_t *queue,
+                                        const char *name,
+                                        const ZephyrMsgQueueStats_t *stats,
+                                        void *userData);
+#endif
+
 /**
  * @brief   Initialize a zephyr message queue.
  *
@@ -39,6 +125,22 @@ typedef struct
  */
 int zephyrMsgQueueInit(ZephyrMsgQueue_t *queue, size_t msgSize, size_t maxMsgCnt);
 
+/**
+ * @brief   Initialize a zephyr message queue with a caller provided storage.
+ *          The storage must be aligned on the message size largest power of
+ *          2 divisor, up to ZEPHYR_MSG_QUEUE_ALIGN, which is guaranteed by
+ *          ZEPHYR_MSG_QUEUE_BUFFER_DEFINE.
+ *
+ * @param queue         The message queue data structure.
+ * @param buffer        The message queue storage of msgSize * maxMsgCnt bytes.
+ * @param msgSize       The message size of the queue.
+ * @param maxMsgCount   The maximum message count in the queue.
+ *
+ * @return              0 if successful, the error code otherwise.
+ */
+int zephyrMsgQueueInitStatic(ZephyrMsgQueue_t *queue, char *buffer,
+                             size_t msgSize, size_t maxMsgCnt);
+
 /**
  * @brief   Push a message to a queue.
  *
@@ -65,6 +167,74 @@ int zephyrMsgQueuePush(ZephyrMsgQueue_t *queue, const void *msg,
 int zephyrMsgQueuePop(ZephyrMsgQueue_t *queue, void *msg,
                       uint32_t timeout, ZephyrTimeUnit_t timeUnit);
 
+/**
+ * @brief   Push a message to a queue, overwriting the oldest message if the
+ *          queue is full. The push never waits and can be called from an
+ *          ISR.
+ *
+ * @param queue       The zephyr message queue.
+ * @param msg         The message to push.
+ * @param dropped     The overwritten message if any, can be NULL.
+ *
+ * @return            1 if the oldest message was overwritten, 0 otherwise.
+ */
+int zephyrMsgQueuePushOverwrite(ZephyrMsgQueue_t *queue, const void *msg,
+                                void *dropped);
+
+/**
+ * @brief   Set the overwrite oldest mode of a queue. In this mode,
+ *          zephyrMsgQueuePush() and zephyrMsgQueuePushMany() never wait and
+ *          overwrite the oldest messages of a full queue.
+ *
+ * @param queue       The zephyr message queue.
+ * @param overwrite   The overwrite oldest mode flag.
+ */
+void zephyrMsgQueueSetOverwrite(ZephyrMsgQueue_t *queue, bool overwrite);
+
+/**
+ * @brief   Get the count of messages overwritten in the queue.
+ *
+ * @param queue       The zephyr message queue.
+ *
+ * @return            The overwritten message count.
+ */
+uint32_t zephyrMsgQueueGetDropCount(ZephyrMsgQueue_t *queue);
+
+/**
+ * @brief   Push several messages to a queue. Only the first message waits for
+ *          space, the following ones are copied under a single lock
+ *          acquisition as long as there is space left.
+ *
+ * @param queue       The zephyr message queue.
+ * @param msgs        The messages to push.
+ * @param msgCnt      The message count to push.
+ * @param timeout     The waiting period if the queue is full.
+ * @param timeUnit    The time unit of the timeout.
+ *
+ * @return            The pushed message count if successful, the error code
+ *                    otherwise.
+ */
+int zephyrMsgQueuePushMany(ZephyrMsgQueue_t *queue, const void *msgs,
+                           size_t msgCnt, uint32_t timeout,
+                           ZephyrTimeUnit_t timeUnit);
+
+/**
+ * @brief   Pop several messages from a queue. Only the first message waits for
+ *          data, the following ones are copied under a single lock
+ *          acquisition as long as there are messages left.
+ *
+ * @param queue       The zephyr message queue.
+ * @param msgs        The popped messages, of at least msgCnt messages.
+ * @param msgCnt      The maximum message count to pop.
+ * @param timeout     The waiting period if the queue is empty.
+ * @param timeUnit    The time unit of the timeout.
+ *
+ * @return            The popped message count if successful, the error code
+ *                    otherwise.
+ */
+int zephyrMsgQueuePopMany(ZephyrMsgQueue_t *queue, void *msgs, size_t msgCnt,
+                          uint32_t timeout, ZephyrTimeUnit_t timeUnit);
+
 /**
  * @brief   Peek a queue for the next message.
  *
@@ -75,6 +245,21 @@ int zephyrMsgQueuePop(ZephyrMsgQueue_t *queue, void *msg,
  */
 int zephyrMsgQueuePeek(ZephyrMsgQueue_t *queue, void *msg);
 
+/**
+ * @brief   Replace in place the oldest queued message equal to a given
+ *          message. The message count does not change, so the producers
+ *          and consumers waiting on the queue are not affected. Replacing a
+ *          message with a marker the consumer skips withdraws it.
+ *
+ * @param queue       The zephyr message queue.
+ * @param msg         The message to replace.
+ * @param newMsg      The replacing message.
+ *
+ * @return            0 if successful, -ENOENT if the message is not queued.
+ */
+int zephyrMsgQueueReplace(ZephyrMsgQueue_t *queue, const void *msg,
+                          const void *newMsg);
+
 /**
  * @brief   Purge a queue of its messages.
  *
@@ -100,6 +285,47 @@ size_t zephyrMsgQueueGetFreeSpace(ZephyrMsgQueue_t *queue);
  */
 size_t zephyrMsgQueueGetMsgCount(ZephyrMsgQueue_t *queue);
 
+#ifdef CONFIG_ENYA_MSG_QUEUE_STATS
+/**
+ * @brief   Register a queue in the statistics registry. A queue must only be
+ *          registered once.
+ *
+ * @param queue       The zephyr message queue.
+ * @param name        The queue name.
+ */
+void zephyrMsgQueueRegister(ZephyrMsgQueue_t *queue, const char *name);
+
+/**
+ * @brief   Get a snapshot of the queue statistics.
+ *
+ * @param queue       The zephyr message queue.
+ * @param stats       The queue statistics.
+ */
+void zephyrMsgQueueGetStats(ZephyrMsgQueue_t *queue,
+                            ZephyrMsgQueueStats_t *stats);
+
+/**
+ * @brief   Reset the queue statistics. The peak message count restarts from
+ *          the current message count.
+ *
+ * @param queue       The zephyr message queue.
+ */
+void zephyrMsgQueueResetStats(ZephyrMsgQueue_t *queue);
+
+/**
+ * @brief   Iterate over the registered queues with a snapshot of their
+ *          statistics.
+ *
+ * @param callback    The iteration callback.
+ * @param userData    The iteration user data.
+ */
+void zephyrMsgQueueForEach(ZephyrMsgQueueStatsCb_t callback, void *userData);
+#endif
+
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif    /* MESSAGE_QUEUE_WRAPPER */
 
@@ -0,0 +1,151 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrMsgQueue.hpp
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Message Queue C++ Wrapper
+ *
+ *            This file is the C++ front end of the message queue wrapper.
+ *            MsgQueue<T, N> owns its storage and uses the fixed-size copies
+ *            of the typed front end.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#ifndef MESSAGE_QUEUE_CPP_WRAPPER
+#define MESSAGE_QUEUE_CPP_WRAPPER
+
+#include <type_traits>
+
+#include "zephyrMsgQueueTyped.h"
+
+namespace Enya
+{
+  /**
+   * @brief   The typed message queue, holding up to N messages of type T.
+   *
+   * @tparam T        The message type, must be trivially copyable.
+   * @tparam N        The maximum message count.
+   */
+  template <typename T, size_t N>
+  class MsgQueue
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "the messages are copied byte-wise");
+    static_assert(N > 0, "the queue needs at least one slot");
+
+  public:
+    /**
+     * @brief   Construct the queue on its own storage.
+     */
+    MsgQueue()
+    {
+      int rc;
+
+      rc = zephyrMsgQueueInitStatic(&queue, buffer, sizeof(T), N);
+      __ASSERT(rc == 0, "message queue init failed (%d)", rc);
+      ARG_UNUSED(rc);
+    }
+
+    MsgQueue(const MsgQueue &) = delete;
+    MsgQueue &operator=(const MsgQueue &) = delete;
+
+    /**
+     * @brief   Push a message.
+     *
+     * @param msg       The message to push.
+     * @param timeout   The waiting period if the queue is full.
+     * @param timeUnit  The time unit of the timeout.
+     *
+     * @return          0 if successful, the error code otherwise.
+     */
+    int push(const T &msg, uint32_t timeout = ZEPHYR_TIME_NO_WAIT,
+             ZephyrTimeUnit_t timeUnit = MILLI_SEC)
+    {
+      if(zephyrMsgQueueTryPutFast(&queue, &msg, sizeof(T)))
+        return 0;
+      return zephyrMsgQueuePush(&queue, &msg, timeout, timeUnit);
+    }
+
+    /**
+     * @brief   Pop a message.
+     *
+     * @param msg       The popped message.
+     * @param timeout   The waiting period if the queue is empty.
+     * @param timeUnit  The time unit of the timeout.
+     *
+     * @return          0 if successful, the error code otherwise.
+     */
+    int pop(T &msg, uint32_t timeout = ZEPHYR_TIME_FOREVER,
+            ZephyrTimeUnit_t timeUnit = MILLI_SEC)
+    {
+      if(zephyrMsgQueueTryGetFast(&queue, &msg, sizeof(T)))
+        return 0;
+      return zephyrMsgQueuePop(&queue, &msg, timeout, timeUnit);
+    }
+
+    /**
+     * @brief   Peek the next message.
+     *
+     * @param msg       The peeked message.
+     *
+     * @return          0 if successful, the error code otherwise.
+     */
+    int peek(T &msg)
+    {
+      return zephyrMsgQueuePeek(&queue, &msg);
+    }
+
+    /**
+     * @brief   Purge the queue of its messages.
+     */
+    void purge()
+    {
+      zephyrMsgQueuePurge(&queue);
+    }
+
+    /**
+     * @brief   Get the number of messages in the queue.
+     *
+     * @return          The number of messages in the queue.
+     */
+    size_t getMsgCount()
+    {
+      return zephyrMsgQueueGetMsgCount(&queue);
+    }
+
+    /**
+     * @brief   Get the available free space in the queue.
+     *
+     * @return          The number of empty message slots.
+     */
+    size_t getFreeSpace()
+    {
+      return zephyrMsgQueueGetFreeSpace(&queue);
+    }
+
+    /**
+     * @brief   Get the underlying message queue, for the C API.
+     *
+     * @return          The message queue.
+     */
+    ZephyrMsgQueue_t *handle()
+    {
+      return &queue;
+    }
+
+  private:
+    /* the storage also meets the message queue alignment, a byte array
+     * message is aligned on 1 but needs up to ZEPHYR_MSG_QUEUE_ALIGN. */
+    alignas(alignof(T) > ZEPHYR_MSG_QUEUE_ALIGN ? alignof(T) :
+            ZEPHYR_MSG_QUEUE_ALIGN)
+      char buffer[sizeof(T) * N];               /**< The queue storage. */
+    ZephyrMsgQueue_t queue;                     /**< The message queue. */
+  };
+}
+
+#endif    /* MESSAGE_QUEUE_CPP_WRAPPER */
+
+/** @} */
@@ -0,0 +1,115 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrMsgQueueSet.c
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Message Queue Set Wrapper
+ *
+ *            This file is the implementation of the message queue set.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#include <limits.h>
+#include <zephyr/logging/log.h>
+
+#include "zephyrMsgQueueSet.h"
+
+LOG_MODULE_DECLARE(ZEPHYR_WRAPPER_MODULE_NAME);
+
+int zephyrMsgQueueSetInit(ZephyrMsgQueueSet_t *set, ZephyrMsgQueue_t **queues,
+                          struct k_poll_event *events, size_t queueCnt)
+{
+  if(!queues || !events || queueCnt == 0 || queueCnt > INT_MAX)
+  {
+    LOG_ERR("invalid message queue set");
+    return -EINVAL;
+  }
+
+  set->queues = queues;
+  set->events = events;
+  set->queueCnt = queueCnt;
+  set->next = 0;
+
+  for(size_t i = 0; i < queueCnt; ++i)
+    k_poll_event_init(events + i, K_POLL_TYPE_MSGQ_DATA_AVAILABLE,
+      K_POLL_MODE_NOTIFY_ONLY, &queues[i]->msgq);
+
+  return 0;
+}
+
+/**
+ * @brief   Wait until any queue of the set has data.
+ *
+ * @param set         The message queue set.
+ * @param wait        The waiting period if all the queues are empty.
+ *
+ * @return            The index of a queue with data if successful, the error
+ *                    code otherwise.
+ */
+static int waitReadyQueue(ZephyrMsgQueueSet_t *set, k_timeout_t wait)
+{
+  int rc;
+  int readyIdx = -EAGAIN;
+  size_t idx;
+
+  rc = k_poll(set->events, set->queueCnt, wait);
+
+  /* every ready event is reset, the first ready one after the last served
+   * queue is served so a busy queue cannot starve the others. */
+  for(size_t i = 0; i < set->queueCnt; ++i)
+  {
+    idx = set->next + i;
+    if(idx >= set->queueCnt)
+      idx -= set->queueCnt;
+
+    if(set->events[idx].state == K_POLL_STATE_MSGQ_DATA_AVAILABLE &&
+       readyIdx < 0)
+      readyIdx = idx;
+
+    set->events[idx].state = K_POLL_STATE_NOT_READY;
+  }
+
+  if(rc < 0)
+    return rc;
+
+  if(readyIdx >= 0)
+  {
+    set->next = readyIdx + 1;
+    if(set->next == set->queueCnt)
+      set->next = 0;
+  }
+
+  return readyIdx;
+}
+
+int zephyrMsgQueueSetWait(ZephyrMsgQueueSet_t *set, uint32_t timeout,
+                          ZephyrTimeUnit_t timeUnit)
+{
+  return waitReadyQueue(set, zephyrCommonProcessTimeout(timeout, timeUnit));
+}
+
+int zephyrMsgQueueSetPop(ZephyrMsgQueueSet_t *set, void *msg,
+                         uint32_t timeout, ZephyrTimeUnit_t timeUnit)
+{
+  int idx;
+  k_timepoint_t end;
+
+  end = sys_timepoint_calc(zephyrCommonProcessTimeout(timeout, timeUnit));
+
+  for(;;)
+  {
+    idx = waitReadyQueue(set, sys_timepoint_timeout(end));
+    if(idx < 0)
+      return idx;
+
+    /* another consumer might have emptied the queue since the wakeup. */
+    if(zephyrMsgQueuePop(set->queues[idx], msg, ZEPHYR_TIME_NO_WAIT,
+                         MILLI_SEC) == 0)
+      return idx;
+  }
+}
+
+/** @} */
@@ -0,0 +1,89 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrMsgQueueSet.h
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Message Queue Set Wrapper
+ *
+ *            This file is the declaration of the message queue set. A set
+ *            waits on several message queues at once with k_poll, so a
+ *            single consumer thread can serve them without polling. The
+ *            ready queues are served in round-robin order.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#ifndef MESSAGE_QUEUE_SET_WRAPPER
+#define MESSAGE_QUEUE_SET_WRAPPER
+
+#include <zephyr/kernel.h>
+
+#include "zephyrCommon.h"
+#include "zephyrMsgQueue.h"
+
+/**
+ * @brief   Define the poll events storage of a message queue set.
+ *
+ * @param _name       The storage name.
+ * @param _queueCnt   The queue count of the set.
+ */
+#define ZEPHYR_MSG_QUEUE_SET_EVENTS_DEFINE(_name, _queueCnt)                  \
+  struct k_poll_event _name[_queueCnt]
+
+/**
+ * @brief   The message queue set data structure.
+ */
+typedef struct
+{
+  ZephyrMsgQueue_t **queues;        /**< The queues of the set. */
+  struct k_poll_event *events;      /**< The poll event of each queue. */
+  size_t queueCnt;                  /**< The queue count. */
+  size_t next;                      /**< The next queue to serve first. */
+} ZephyrMsgQueueSet_t;
+
+/**
+ * @brief   Initialize a message queue set.
+ *
+ * @param set         The message queue set.
+ * @param queues      The queues of the set, must outlive the set.
+ * @param events      The poll events storage of queueCnt events.
+ * @param queueCnt    The queue count.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrMsgQueueSetInit(ZephyrMsgQueueSet_t *set, ZephyrMsgQueue_t **queues,
+                          struct k_poll_event *events, size_t queueCnt);
+
+/**
+ * @brief   Wait until any queue of the set has data.
+ *
+ * @param set         The message queue set.
+ * @param timeout     The waiting period if all the queues are empty.
+ * @param timeUnit    The time unit of the timeout.
+ *
+ * @return            The index of a queue with data if successful, the error
+ *                    code otherwise.
+ */
+int zephyrMsgQueueSetWait(ZephyrMsgQueueSet_t *set, uint32_t timeout,
+                          ZephyrTimeUnit_t timeUnit);
+
+/**
+ * @brief   Pop a message from any queue of the set.
+ *
+ * @param set         The message queue set.
+ * @param msg         The popped message, large enough for the largest
+ *                    message size of the set.
+ * @param timeout     The waiting period if all the queues are empty.
+ * @param timeUnit    The time unit of the timeout.
+ *
+ * @return            The index of the queue the message was popped from if
+ *                    successful, the error code otherwise.
+ */
+int zephyrMsgQueueSetPop(ZephyrMsgQueueSet_t *set, void *msg,
+                         uint32_t timeout, ZephyrTimeUnit_t timeUnit);
+
+#endif    /* MESSAGE_QUEUE_SET_WRAPPER */
+
+/** @} */
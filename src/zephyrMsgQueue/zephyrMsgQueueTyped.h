@@ -0,0 +1,187 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrMsgQueueTyped.h
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Typed Message Queue Wrapper
+ *
+ *            This file is the typed front end of the message queue wrapper.
+ *            ZEPHYR_MSG_QUEUE_TYPED_DECLARE generates a queue type and its
+ *            inline functions for a message type, so the message size is a
+ *            compile-time constant and a queue of another message type does
+ *            not compile. When no thread waits on the queue, the message is
+ *            copied in the ring with a fixed-size copy. Otherwise, the
+ *            generic push and pop hand the message to the waiting thread.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#ifndef TYPED_MESSAGE_QUEUE_WRAPPER
+#define TYPED_MESSAGE_QUEUE_WRAPPER
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/util.h>
+
+#include "zephyrCommon.h"
+#include "zephyrMsgQueue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Define a typed message queue with its storage at build time. The
+ *          queue type must be declared with ZEPHYR_MSG_QUEUE_TYPED_DECLARE.
+ *          The queue is initialized at boot like ZEPHYR_MSG_QUEUE_DEFINE.
+ *
+ * @param _name       The message queue name.
+ * @param _prefix     The typed functions name prefix.
+ * @param _maxMsgCnt  The maximum message count in the queue.
+ */
+#define ZEPHYR_MSG_QUEUE_TYPED_DEFINE(_name, _prefix, _maxMsgCnt)             \
+  static ZEPHYR_MSG_QUEUE_BUFFER_DEFINE(_name##Buffer, sizeof(_prefix##Msg_t),\
+                                        _maxMsgCnt);                          \
+  _prefix##Queue_t _name;                                                     \
+  static int _name##Init(void)                                                \
+  {                                                                           \
+    return _prefix##InitStatic(&_name, _name##Buffer, _maxMsgCnt);            \
+  }                                                                           \
+  SYS_INIT(_name##Init, PRE_KERNEL_2, 0)
+
+/**
+ * @brief   Declare the typed queue of a message type: _prefix##Msg_t, the
+ *          _prefix##Queue_t queue type wrapping a ZephyrMsgQueue_t, and the
+ *          _prefix##Init, _prefix##InitStatic, _prefix##Push and
+ *          _prefix##Pop inline functions. The queue member is the message
+ *          queue for the rest of the C API.
+ *
+ * @param _prefix     The types and functions name prefix.
+ * @param _type       The message type.
+ */
+#define ZEPHYR_MSG_QUEUE_TYPED_DECLARE(_prefix, _type)                        \
+  typedef _type _prefix##Msg_t;                                               \
+                                                                              \
+  typedef struct                                                              \
+  {                                                                           \
+    ZephyrMsgQueue_t queue;                                                   \
+  } _prefix##Queue_t;                                                         \
+                                                                              \
+  static inline int _prefix##Init(_prefix##Queue_t *queue, size_t maxMsgCnt)  \
+  {                                                                           \
+    return zephyrMsgQueueInit(&queue->queue, sizeof(_type), maxMsgCnt);       \
+  }                                                                           \
+                                                                              \
+  static inline int _prefix##InitStatic(_prefix##Queue_t *queue,              \
+                                        char *buffer, size_t maxMsgCnt)       \
+  {                                                                           \
+    return zephyrMsgQueueInitStatic(&queue->queue, buffer, sizeof(_type),     \
+                                    maxMsgCnt);                               \
+  }                                                                           \
+                                                                              \
+  static inline int _prefix##Push(_prefix##Queue_t *queue, const _type *msg,  \
+                                  uint32_t timeout,                           \
+                                  ZephyrTimeUnit_t timeUnit)                  \
+  {                                                                           \
+    if(zephyrMsgQueueTryPutFast(&queue->queue, msg, sizeof(_type)))           \
+      return 0;                                                               \
+    return zephyrMsgQueuePush(&queue->queue, msg, timeout, timeUnit);         \
+  }                                                                           \
+                                                                              \
+  static inline int _prefix##Pop(_prefix##Queue_t *queue, _type *msg,         \
+                                 uint32_t timeout, ZephyrTimeUnit_t timeUnit) \
+  {                                                                           \
+    if(zephyrMsgQueueTryGetFast(&queue->queue, msg, sizeof(_type)))           \
+      return 0;                                                               \
+    return zephyrMsgQueuePop(&queue->queue, msg, timeout, timeUnit);          \
+  }
+
+/**
+ * @brief   Try to copy a message in the queue ring with a fixed-size copy.
+ *          The copy is only done when the queue is neither empty, no reader
+ *          can be waiting, nor full. The statistics build always uses the
+ *          generic path.
+ *
+ * @param queue       The zephyr message queue.
+ * @param msg         The message to push.
+ * @param msgSize     The message size, a compile-time constant.
+ *
+ * @return            true if the message was pushed, false otherwise.
+ */
+static ALWAYS_INLINE bool zephyrMsgQueueTryPutFast(ZephyrMsgQueue_t *queue,
+                                                   const void *msg,
+                                                   size_t msgSize)
+{
+  bool pushed = false;
+  k_spinlock_key_t key;
+  struct k_msgq *msgq = &queue->msgq;
+
+  if(IS_ENABLED(CONFIG_ENYA_MSG_QUEUE_STATS))
+    return false;
+
+  key = k_spin_lock(&msgq->lock);
+
+  if(msgq->used_msgs > 0 && msgq->used_msgs < msgq->max_msgs)
+  {
+    memcpy(msgq->write_ptr, msg, msgSize);
+    msgq->write_ptr += msgSize;
+    if(msgq->write_ptr == msgq->buffer_end)
+      msgq->write_ptr = msgq->buffer_start;
+    ++msgq->used_msgs;
+    pushed = true;
+  }
+
+  k_spin_unlock(&msgq->lock, key);
+
+  return pushed;
+}
+
+/**
+ * @brief   Try to copy a message from the queue ring with a fixed-size copy.
+ *          The copy is only done when the queue is neither full, no writer
+ *          can be waiting, nor empty. The statistics build always uses the
+ *          generic path.
+ *
+ * @param queue       The zephyr message queue.
+ * @param msg         The popped message.
+ * @param msgSize     The message size, a compile-time constant.
+ *
+ * @return            true if a message was popped, false otherwise.
+ */
+static ALWAYS_INLINE bool zephyrMsgQueueTryGetFast(ZephyrMsgQueue_t *queue,
+                                                   void *msg, size_t msgSize)
+{
+  bool popped = false;
+  k_spinlock_key_t key;
+  struct k_msgq *msgq = &queue->msgq;
+
+  if(IS_ENABLED(CONFIG_ENYA_MSG_QUEUE_STATS))
+    return false;
+
+  key = k_spin_lock(&msgq->lock);
+
+  if(msgq->used_msgs > 0 && msgq->used_msgs < msgq->max_msgs)
+  {
+    memcpy(msg, msgq->read_ptr, msgSize);
+    msgq->read_ptr += msgSize;
+    if(msgq->read_ptr == msgq->buffer_end)
+      msgq->read_ptr = msgq->buffer_start;
+    --msgq->used_msgs;
+    popped = true;
+  }
+
+  k_spin_unlock(&msgq->lock, key);
+
+  return popped;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif    /* TYPED_MESSAGE_QUEUE_WRAPPER */
+
+/** @} */
@@ -0,0 +1,101 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrMsgRpc.c
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Message RPC Wrapper
+ *
+ *            This file is the implementation of the request/response helper
+ *            over a message queue.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#include <zephyr/logging/log.h>
+
+#include "zephyrMsgRpc.h"
+
+LOG_MODULE_DECLARE(ZEPHYR_WRAPPER_MODULE_NAME);
+
+int zephyrRpcInit(ZephyrRpc_t *rpc, char *buffer, size_t depth)
+{
+  return zephyrMsgQueueInitStatic(&rpc->queue, buffer, sizeof(void *), depth);
+}
+
+int zephyrRpcCall(ZephyrRpc_t *rpc, const void *request, void *response,
+                  uint32_t timeout, ZephyrTimeUnit_t timeUnit)
+{
+  int rc;
+  k_timepoint_t end;
+  ZephyrRpcCall_t call;
+  ZephyrRpcCall_t *callPtr = &call;
+  ZephyrRpcCall_t *withdrawn = NULL;
+
+  end = sys_timepoint_calc(zephyrCommonProcessTimeout(timeout, timeUnit));
+
+  call.request = request;
+  call.response = response;
+  call.rc = 0;
+  atomic_set(&call.state, RPC_STATE_PENDING);
+  k_sem_init(&call.done, 0, 1);
+
+  rc = zephyrMsgQueuePush(&rpc->queue, &callPtr, timeout, timeUnit);
+  if(rc < 0)
+    return rc;
+
+  rc = k_sem_take(&call.done, sys_timepoint_timeout(end));
+  if(rc == 0)
+    return call.rc;
+
+  /* the call is on this stack, it must not be left behind in the queue. Its
+   * slot is withdrawn in place, the server skips it. */
+  if(zephyrMsgQueueReplace(&rpc->queue, &callPtr, &withdrawn) == 0)
+    return -EAGAIN;
+
+  /* the server already popped the call. A call it did not start yet is
+   * cancelled, but both cases are waited for until the server lets go. */
+  if(atomic_cas(&call.state, RPC_STATE_PENDING, RPC_STATE_CANCELLED))
+  {
+    k_sem_take(&call.done, K_FOREVER);
+    return -EAGAIN;
+  }
+
+  k_sem_take(&call.done, K_FOREVER);
+
+  return call.rc;
+}
+
+int zephyrRpcReceive(ZephyrRpc_t *rpc, ZephyrRpcCall_t **call,
+                     uint32_t timeout, ZephyrTimeUnit_t timeUnit)
+{
+  int rc;
+
+  rc = zephyrMsgQueuePop(&rpc->queue, call, timeout, timeUnit);
+  if(rc < 0)
+    return rc;
+
+  /* withdrawn by a client timing out before the call was received. */
+  if(!*call)
+    return -ECANCELED;
+
+  if(!atomic_cas(&(*call)->state, RPC_STATE_PENDING, RPC_STATE_ACTIVE))
+  {
+    /* cancelled, the client waits for this release only. */
+    k_sem_give(&(*call)->done);
+    *call = NULL;
+    return -ECANCELED;
+  }
+
+  return 0;
+}
+
+void zephyrRpcComplete(ZephyrRpcCall_t *call, int rc)
+{
+  call->rc = rc;
+  atomic_set(&call->state, RPC_STATE_DONE);
+  k_sem_give(&call->done);
+}
+
+/** @} */
@@ -0,0 +1,123 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrMsgRpc.h
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Message RPC Wrapper
+ *
+ *            This file is the declaration of the request/response helper
+ *            over a message queue. The client call lives on the client
+ *            stack and only its pointer is queued. The server reads the
+ *            request and writes the response in place, then completes the
+ *            call to wake the client up. No reply queue is needed.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#ifndef MESSAGE_RPC_WRAPPER
+#define MESSAGE_RPC_WRAPPER
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#include "zephyrCommon.h"
+#include "zephyrMsgQueue.h"
+
+/**
+ * @brief   Define a RPC call queue buffer, sized and aligned at build time.
+ *
+ * @param _name       The buffer name.
+ * @param _depth      The maximum count of pending calls.
+ */
+#define ZEPHYR_RPC_BUFFER_DEFINE(_name, _depth)                               \
+  ZEPHYR_MSG_QUEUE_BUFFER_DEFINE(_name, sizeof(void *), _depth)
+
+/**
+ * @brief   The RPC call states.
+ */
+typedef enum
+{
+  RPC_STATE_PENDING,                /**< The call waits for the server. */
+  RPC_STATE_ACTIVE,                 /**< The server handles the call. */
+  RPC_STATE_DONE,                   /**< The server completed the call. */
+  RPC_STATE_CANCELLED,              /**< The client cancelled the call. */
+} ZephyrRpcState_t;
+
+/**
+ * @brief   The RPC call data structure.
+ */
+typedef struct
+{
+  atomic_t state;                   /**< The call state. */
+  struct k_sem done;                /**< The call completion semaphore. */
+  const void *request;              /**< The request, read by the server. */
+  void *response;                   /**< The response, written by the server. */
+  int rc;                           /**< The server return code. */
+} ZephyrRpcCall_t;
+
+/**
+ * @brief   The RPC endpoint data structure.
+ */
+typedef struct
+{
+  ZephyrMsgQueue_t queue;           /**< The pending call queue. */
+} ZephyrRpc_t;
+
+/**
+ * @brief   Initialize a RPC endpoint.
+ *
+ * @param rpc         The RPC endpoint.
+ * @param buffer      The call queue buffer, usually defined with
+ *                    ZEPHYR_RPC_BUFFER_DEFINE.
+ * @param depth       The maximum count of pending calls.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrRpcInit(ZephyrRpc_t *rpc, char *buffer, size_t depth);
+
+/**
+ * @brief   Call the server and wait for its response. The timeout covers the
+ *          whole call. A call already handled by the server when the timeout
+ *          expires is waited for until completion.
+ *
+ * @param rpc         The RPC endpoint.
+ * @param request     The request.
+ * @param response    The response, written by the server.
+ * @param timeout     The call timeout.
+ * @param timeUnit    The time unit of the timeout.
+ *
+ * @return            The server return code if successful, the error code
+ *                    otherwise.
+ */
+int zephyrRpcCall(ZephyrRpc_t *rpc, const void *request, void *response,
+                  uint32_t timeout, ZephyrTimeUnit_t timeUnit);
+
+/**
+ * @brief   Receive a call to handle. Every received call must be completed
+ *          with zephyrRpcComplete().
+ *
+ * @param rpc         The RPC endpoint.
+ * @param call        The received call.
+ * @param timeout     The waiting period if no call is pending.
+ * @param timeUnit    The time unit of the timeout.
+ *
+ * @return            0 if successful, -ECANCELED if the received call was
+ *                    cancelled or withdrawn and must not be completed, the
+ *                    error code otherwise.
+ */
+int zephyrRpcReceive(ZephyrRpc_t *rpc, ZephyrRpcCall_t **call,
+                     uint32_t timeout, ZephyrTimeUnit_t timeUnit);
+
+/**
+ * @brief   Complete a received call. The call must not be used afterward.
+ *
+ * @param call        The call.
+ * @param rc          The return code for the client.
+ */
+void zephyrRpcComplete(ZephyrRpcCall_t *call, int rc);
+
+#endif    /* MESSAGE_RPC_WRAPPER */
+
+/** @} */
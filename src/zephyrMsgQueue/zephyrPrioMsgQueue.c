@@ -0,0 +1,166 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrPrioMsgQueue.c
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Priority Message Queue Wrapper
+ *
+ *            This file is the implementation of the priority message queue
+ *            wrapper.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/sys/util.h>
+
+#include "zephyrPrioMsgQueue.h"
+
+LOG_MODULE_DECLARE(ZEPHYR_WRAPPER_MODULE_NAME);
+
+BUILD_ASSERT(ZEPHYR_PRIO_MSG_QUEUE_LEVELS <= 32,
+             "the pending levels bitmap holds 32 levels");
+
+/**
+ * @brief   Convert a semaphore take error to the message queue error codes.
+ *
+ * @param rc          The semaphore take return code.
+ *
+ * @return            -ENOMSG if not waiting, the return code otherwise.
+ */
+static inline int semToMsgQueueError(int rc)
+{
+  return rc == -EBUSY ? -ENOMSG : rc;
+}
+
+int zephyrPrioMsgQueueInit(ZephyrPrioMsgQueue_t *queue, size_t msgSize,
+                           size_t maxMsgCnt)
+{
+  int rc;
+  char *buffer;
+
+  buffer = k_malloc(msgSize * maxMsgCnt * ZEPHYR_PRIO_MSG_QUEUE_LEVELS);
+  if(!buffer)
+    return -ENOSPC;
+
+  rc = zephyrPrioMsgQueueInitStatic(queue, buffer, msgSize, maxMsgCnt);
+  if(rc < 0)
+    k_free(buffer);
+
+  return rc;
+}
+
+int zephyrPrioMsgQueueInitStatic(ZephyrPrioMsgQueue_t *queue, char *buffer,
+                                 size_t msgSize, size_t maxMsgCnt)
+{
+  /* the largest power of 2 dividing the message size. */
+  size_t align = MIN(msgSize & -msgSize, ZEPHYR_MSG_QUEUE_ALIGN);
+
+  if(!buffer || msgSize == 0 || maxMsgCnt == 0 || maxMsgCnt > K_SEM_MAX_LIMIT ||
+     !IS_ALIGNED(buffer, align))
+  {
+    LOG_ERR("invalid priority message queue storage");
+    return -EINVAL;
+  }
+
+  queue->buffer = buffer;
+  queue->msgSize = msgSize;
+  queue->maxMsgCnt = maxMsgCnt;
+  queue->pendingLevels = 0;
+
+  for(uint8_t i = 0; i < ZEPHYR_PRIO_MSG_QUEUE_LEVELS; ++i)
+  {
+    queue->levels[i].buffer = buffer + i * msgSize * maxMsgCnt;
+    queue->levels[i].readIdx = 0;
+    queue->levels[i].msgCnt = 0;
+    k_sem_init(&queue->levels[i].space, maxMsgCnt, maxMsgCnt);
+  }
+
+  k_sem_init(&queue->msgs, 0, K_SEM_MAX_LIMIT);
+
+  return 0;
+}
+
+int zephyrPrioMsgQueuePush(ZephyrPrioMsgQueue_t *queue, const void *msg,
+                           uint8_t prio, uint32_t timeout,
+                           ZephyrTimeUnit_t timeUnit)
+{
+  int rc;
+  uint32_t writeIdx;
+  k_spinlock_key_t key;
+  ZephyrPrioMsgQueueLevel_t *level;
+
+  if(prio >= ZEPHYR_PRIO_MSG_QUEUE_LEVELS)
+  {
+    LOG_ERR("invalid priority level %d", prio);
+    return -EINVAL;
+  }
+
+  level = queue->levels + prio;
+
+  /* reserve a slot in the level, the ring itself is only touched locked. */
+  rc = k_sem_take(&level->space, zephyrCommonProcessTimeout(timeout, timeUnit));
+  if(rc < 0)
+    return semToMsgQueueError(rc);
+
+  key = k_spin_lock(&queue->lock);
+
+  writeIdx = level->readIdx + level->msgCnt;
+  if(writeIdx >= queue->maxMsgCnt)
+    writeIdx -= queue->maxMsgCnt;
+
+  memcpy(level->buffer + writeIdx * queue->msgSize, msg, queue->msgSize);
+  ++level->msgCnt;
+  queue->pendingLevels |= BIT(prio);
+
+  k_spin_unlock(&queue->lock, key);
+
+  k_sem_give(&queue->msgs);
+
+  return 0;
+}
+
+int zephyrPrioMsgQueuePop(ZephyrPrioMsgQueue_t *queue, void *msg,
+                          uint8_t *prio, uint32_t timeout,
+                          ZephyrTimeUnit_t timeUnit)
+{
+  int rc;
+  uint8_t levelIdx;
+  k_spinlock_key_t key;
+  ZephyrPrioMsgQueueLevel_t *level;
+
+  rc = k_sem_take(&queue->msgs, zephyrCommonProcessTimeout(timeout, timeUnit));
+  if(rc < 0)
+    return semToMsgQueueError(rc);
+
+  key = k_spin_lock(&queue->lock);
+
+  /* the lowest set bit is the highest pending priority. */
+  levelIdx = u32_count_trailing_zeros(queue->pendingLevels);
+  level = queue->levels + levelIdx;
+
+  memcpy(msg, level->buffer + level->readIdx * queue->msgSize, queue->msgSize);
+  if(++level->readIdx == queue->maxMsgCnt)
+    level->readIdx = 0;
+  if(--level->msgCnt == 0)
+    queue->pendingLevels &= ~BIT(levelIdx);
+
+  k_spin_unlock(&queue->lock, key);
+
+  k_sem_give(&level->space);
+
+  if(prio)
+    *prio = levelIdx;
+
+  return 0;
+}
+
+uint32_t zephyrPrioMsgQueueGetMsgCount(ZephyrPrioMsgQueue_t *queue)
+{
+  return k_sem_count_get(&queue->msgs);
+}
+
+/** @} */
@@ -0,0 +1,137 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrPrioMsgQueue.h
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Priority Message Queue Wrapper
+ *
+ *            This file is the declaration of the priority message queue
+ *            wrapper. Each priority level has its own ring and a bitmap of
+ *            the non-empty levels gives the highest pending level in O(1).
+ *            Level 0 is the highest priority, messages of the same level are
+ *            popped in FIFO order.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#ifndef PRIO_MESSAGE_QUEUE_WRAPPER
+#define PRIO_MESSAGE_QUEUE_WRAPPER
+
+#include <zephyr/kernel.h>
+
+#include "zephyrCommon.h"
+#include "zephyrMsgQueue.h"
+
+/**
+ * @brief   The priority level count.
+ */
+#define ZEPHYR_PRIO_MSG_QUEUE_LEVELS    CONFIG_ENYA_MSG_QUEUE_PRIORITY_LEVELS
+
+/**
+ * @brief   Define a priority message queue storage buffer, sized and aligned
+ *          at build time.
+ *
+ * @param _name       The buffer name.
+ * @param _msgSize    The message size of the queue.
+ * @param _maxMsgCnt  The maximum message count of each level.
+ */
+#define ZEPHYR_PRIO_MSG_QUEUE_BUFFER_DEFINE(_name, _msgSize, _maxMsgCnt)      \
+  ZEPHYR_MSG_QUEUE_BUFFER_DEFINE(_name, _msgSize,                             \
+                                 (_maxMsgCnt) * ZEPHYR_PRIO_MSG_QUEUE_LEVELS)
+
+/**
+ * @brief   The priority message queue level data structure.
+ */
+typedef struct
+{
+  char *buffer;                     /**< The level ring buffer. */
+  uint32_t readIdx;                 /**< The index of the oldest message. */
+  uint32_t msgCnt;                  /**< The message count of the level. */
+  struct k_sem space;               /**< The free message slot semaphore. */
+} ZephyrPrioMsgQueueLevel_t;
+
+/**
+ * @brief   The priority message queue data structure.
+ */
+typedef struct
+{
+  /** The priority levels, level 0 being the highest. */
+  ZephyrPrioMsgQueueLevel_t levels[ZEPHYR_PRIO_MSG_QUEUE_LEVELS];
+  char *buffer;                     /**< The message queue buffer. */
+  size_t msgSize;                   /**< The message size. */
+  uint32_t maxMsgCnt;               /**< The maximum message count of each level. */
+  uint32_t pendingLevels;           /**< The bitmap of the non-empty levels. */
+  struct k_spinlock lock;           /**< The level rings lock. */
+  struct k_sem msgs;                /**< The pending message semaphore. */
+} ZephyrPrioMsgQueue_t;
+
+/**
+ * @brief   Initialize a priority message queue.
+ *
+ * @param queue       The priority message queue.
+ * @param msgSize     The message size.
+ * @param maxMsgCnt   The maximum message count of each level.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrPrioMsgQueueInit(ZephyrPrioMsgQueue_t *queue, size_t msgSize,
+                           size_t maxMsgCnt);
+
+/**
+ * @brief   Initialize a priority message queue with a caller provided storage,
+ *          usually defined with ZEPHYR_PRIO_MSG_QUEUE_BUFFER_DEFINE.
+ *
+ * @param queue       The priority message queue.
+ * @param buffer      The queue storage.
+ * @param msgSize     The message size.
+ * @param maxMsgCnt   The maximum message count of each level.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrPrioMsgQueueInitStatic(ZephyrPrioMsgQueue_t *queue, char *buffer,
+                                 size_t msgSize, size_t maxMsgCnt);
+
+/**
+ * @brief   Push a message in a priority level of the queue.
+ *
+ * @param queue       The priority message queue.
+ * @param msg         The message.
+ * @param prio        The priority level, 0 being the highest.
+ * @param timeout     The waiting period if the level is full.
+ * @param timeUnit    The time unit of the timeout.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrPrioMsgQueuePush(ZephyrPrioMsgQueue_t *queue, const void *msg,
+                           uint8_t prio, uint32_t timeout,
+                           ZephyrTimeUnit_t timeUnit);
+
+/**
+ * @brief   Pop the oldest message of the highest pending priority level.
+ *
+ * @param queue       The priority message queue.
+ * @param msg         The popped message.
+ * @param prio        The priority level of the popped message, can be NULL.
+ * @param timeout     The waiting period if the queue is empty.
+ * @param timeUnit    The time unit of the timeout.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrPrioMsgQueuePop(ZephyrPrioMsgQueue_t *queue, void *msg,
+                          uint8_t *prio, uint32_t timeout,
+                          ZephyrTimeUnit_t timeUnit);
+
+/**
+ * @brief   Get the message count of the queue, all levels included.
+ *
+ * @param queue       The priority message queue.
+ *
+ * @return            The message count.
+ */
+uint32_t zephyrPrioMsgQueueGetMsgCount(ZephyrPrioMsgQueue_t *queue);
+
+#endif    /* PRIO_MESSAGE_QUEUE_WRAPPER */
+
+/** @} */
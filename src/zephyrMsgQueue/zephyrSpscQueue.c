@@ -0,0 +1,141 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrSpscQueue.c
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Single Producer Single Consumer Queue Wrapper
+ *
+ *            This file is the implementation of the single producer single
+ *            consumer queue.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+#include "zephyrSpscQueue.h"
+
+LOG_MODULE_DECLARE(ZEPHYR_WRAPPER_MODULE_NAME);
+
+int zephyrSpscQueueInit(ZephyrSpscQueue_t *queue, size_t msgSize,
+                        size_t maxMsgCnt, ZephyrSpscWakeup_t wakeup)
+{
+  int rc;
+  char *buffer;
+
+  buffer = k_malloc(msgSize * maxMsgCnt);
+  if(!buffer)
+    return -ENOSPC;
+
+  rc = zephyrSpscQueueInitStatic(queue, buffer, msgSize, maxMsgCnt, wakeup);
+  if(rc < 0)
+    k_free(buffer);
+
+  return rc;
+}
+
+int zephyrSpscQueueInitStatic(ZephyrSpscQueue_t *queue, char *buffer,
+                              size_t msgSize, size_t maxMsgCnt,
+                              ZephyrSpscWakeup_t wakeup)
+{
+  /* the largest power of 2 dividing the message size. */
+  size_t align = MIN(msgSize & -msgSize, ZEPHYR_MSG_QUEUE_ALIGN);
+
+  if(!buffer || msgSize == 0 || !IS_ALIGNED(buffer, align))
+  {
+    LOG_ERR("invalid SPSC queue storage");
+    return -EINVAL;
+  }
+
+  if(!IS_POWER_OF_TWO(maxMsgCnt) || maxMsgCnt > (1U << 31))
+  {
+    LOG_ERR("invalid SPSC queue size %zu, must be a power of two", maxMsgCnt);
+    return -EINVAL;
+  }
+
+  queue->buffer = buffer;
+  queue->msgSize = msgSize;
+  queue->mask = maxMsgCnt - 1;
+  queue->wakeup = wakeup;
+  atomic_clear(&queue->head);
+  atomic_clear(&queue->tail);
+  k_sem_init(&queue->signal, 0, K_SEM_MAX_LIMIT);
+
+  return 0;
+}
+
+int zephyrSpscQueuePush(ZephyrSpscQueue_t *queue, const void *msg)
+{
+  uint32_t head = (uint32_t)atomic_get(&queue->head);
+  uint32_t tail = (uint32_t)atomic_get(&queue->tail);
+
+  if(head - tail > queue->mask)
+    return -ENOMSG;
+
+  memcpy(queue->buffer + (head & queue->mask) * queue->msgSize, msg,
+    queue->msgSize);
+
+  /* publishing the head after the copy hands the message to the consumer. */
+  atomic_set(&queue->head, head + 1);
+
+  switch(queue->wakeup)
+  {
+    case SPSC_WAKEUP_ALWAYS:
+      k_sem_give(&queue->signal);
+      break;
+    case SPSC_WAKEUP_ON_EMPTY:
+      /* the tail is read back after publishing the head. If the consumer
+       * had drained the queue, it might be waiting for this message. */
+      if((uint32_t)atomic_get(&queue->tail) == head)
+        k_sem_give(&queue->signal);
+      break;
+    default:
+      break;
+  }
+
+  return 0;
+}
+
+int zephyrSpscQueuePop(ZephyrSpscQueue_t *queue, void *msg,
+                       uint32_t timeout, ZephyrTimeUnit_t timeUnit)
+{
+  int rc;
+  uint32_t head;
+  uint32_t tail;
+  k_timepoint_t end;
+
+  end = sys_timepoint_calc(zephyrCommonProcessTimeout(timeout, timeUnit));
+
+  for(;;)
+  {
+    tail = (uint32_t)atomic_get(&queue->tail);
+    head = (uint32_t)atomic_get(&queue->head);
+
+    if(head != tail)
+    {
+      memcpy(msg, queue->buffer + (tail & queue->mask) * queue->msgSize,
+        queue->msgSize);
+      atomic_set(&queue->tail, tail + 1);
+      return 0;
+    }
+
+    if(queue->wakeup == SPSC_WAKEUP_NONE)
+      return -ENOMSG;
+
+    /* a wakeup may be left over from an already popped message, the queue
+     * is checked again after every wakeup. */
+    rc = k_sem_take(&queue->signal, sys_timepoint_timeout(end));
+    if(rc < 0)
+      return rc == -EBUSY ? -ENOMSG : rc;
+  }
+}
+
+uint32_t zephyrSpscQueueGetMsgCount(ZephyrSpscQueue_t *queue)
+{
+  return (uint32_t)atomic_get(&queue->head) - (uint32_t)atomic_get(&queue->tail);
+}
+
+/** @} */
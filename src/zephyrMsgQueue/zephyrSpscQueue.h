@@ -0,0 +1,130 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrSpscQueue.h
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Single Producer Single Consumer Queue Wrapper
+ *
+ *            This file is the declaration of the single producer single
+ *            consumer queue. The queue only uses atomic head and tail indices
+ *            on a power of two ring, the push never locks and is meant for
+ *            high rate ISR to thread handoff. Only one context may push and
+ *            only one context may pop at a time.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#ifndef SPSC_QUEUE_WRAPPER
+#define SPSC_QUEUE_WRAPPER
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#include "zephyrCommon.h"
+#include "zephyrMsgQueue.h"
+
+/**
+ * @brief   Define a SPSC queue storage buffer, sized and aligned at build
+ *          time. The maximum message count must be a power of two.
+ *
+ * @param _name       The buffer name.
+ * @param _msgSize    The message size of the queue.
+ * @param _maxMsgCnt  The maximum message count in the queue.
+ */
+#define ZEPHYR_SPSC_QUEUE_BUFFER_DEFINE(_name, _msgSize, _maxMsgCnt)          \
+  ZEPHYR_MSG_QUEUE_BUFFER_DEFINE(_name, _msgSize, _maxMsgCnt);                \
+  BUILD_ASSERT(IS_POWER_OF_TWO(_maxMsgCnt),                                   \
+               "the SPSC queue size must be a power of two")
+
+/**
+ * @brief   The consumer wakeup policies.
+ */
+typedef enum
+{
+  SPSC_WAKEUP_NONE,                 /**< Never signal, the consumer polls. */
+  SPSC_WAKEUP_ALWAYS,               /**< Signal on every push. */
+  SPSC_WAKEUP_ON_EMPTY,             /**< Signal when pushing in a drained queue. */
+} ZephyrSpscWakeup_t;
+
+/**
+ * @brief   The SPSC queue data structure.
+ */
+typedef struct
+{
+  char *buffer;                     /**< The queue ring buffer. */
+  size_t msgSize;                   /**< The message size. */
+  uint32_t mask;                    /**< The ring index mask. */
+  atomic_t head;                    /**< The pushed message count. */
+  atomic_t tail;                    /**< The popped message count. */
+  ZephyrSpscWakeup_t wakeup;        /**< The consumer wakeup policy. */
+  struct k_sem signal;              /**< The consumer wakeup, k_poll-able. */
+} ZephyrSpscQueue_t;
+
+/**
+ * @brief   Initialize a SPSC queue.
+ *
+ * @param queue       The SPSC queue.
+ * @param msgSize     The message size.
+ * @param maxMsgCnt   The maximum message count, must be a power of two.
+ * @param wakeup      The consumer wakeup policy.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrSpscQueueInit(ZephyrSpscQueue_t *queue, size_t msgSize,
+                        size_t maxMsgCnt, ZephyrSpscWakeup_t wakeup);
+
+/**
+ * @brief   Initialize a SPSC queue with a caller provided storage, usually
+ *          defined with ZEPHYR_SPSC_QUEUE_BUFFER_DEFINE.
+ *
+ * @param queue       The SPSC queue.
+ * @param buffer      The queue storage.
+ * @param msgSize     The message size.
+ * @param maxMsgCnt   The maximum message count, must be a power of two.
+ * @param wakeup      The consumer wakeup policy.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrSpscQueueInitStatic(ZephyrSpscQueue_t *queue, char *buffer,
+                              size_t msgSize, size_t maxMsgCnt,
+                              ZephyrSpscWakeup_t wakeup);
+
+/**
+ * @brief   Push a message in the queue. The push never blocks and can be
+ *          called from an ISR.
+ *
+ * @param queue       The SPSC queue.
+ * @param msg         The message.
+ *
+ * @return            0 if successful, -ENOMSG if the queue is full.
+ */
+int zephyrSpscQueuePush(ZephyrSpscQueue_t *queue, const void *msg);
+
+/**
+ * @brief   Pop a message from the queue. With the SPSC_WAKEUP_NONE policy,
+ *          the pop never waits.
+ *
+ * @param queue       The SPSC queue.
+ * @param msg         The popped message.
+ * @param timeout     The waiting period if the queue is empty.
+ * @param timeUnit    The time unit of the timeout.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrSpscQueuePop(ZephyrSpscQueue_t *queue, void *msg,
+                       uint32_t timeout, ZephyrTimeUnit_t timeUnit);
+
+/**
+ * @brief   Get the message count of the queue.
+ *
+ * @param queue       The SPSC queue.
+ *
+ * @return            The message count.
+ */
+uint32_t zephyrSpscQueueGetMsgCount(ZephyrSpscQueue_t *queue);
+
+#endif    /* SPSC_QUEUE_WRAPPER */
+
+/** @} */
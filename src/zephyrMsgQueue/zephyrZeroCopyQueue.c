@@ -0,0 +1,146 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrZeroCopyQueue.c
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Zero-Copy Message Queue Wrapper
+ *
+ *            This file is the implementation of the zero-copy message queue
+ *            wrapper.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+#include "zephyrZeroCopyQueue.h"
+
+LOG_MODULE_DECLARE(ZEPHYR_WRAPPER_MODULE_NAME);
+
+/**
+ * @brief   Update the peak allocated block count.
+ *
+ * @param queue       The zero-copy queue.
+ */
+static void updatePeakUsage(ZephyrZeroCopyQueue_t *queue)
+{
+  atomic_val_t used = k_mem_slab_num_used_get(&queue->pool);
+  atomic_val_t peak;
+
+  do
+  {
+    peak = atomic_get(&queue->peakUsedBlocks);
+    if(used <= peak)
+      return;
+  } while(!atomic_cas(&queue->peakUsedBlocks, peak, used));
+}
+
+int zephyrZeroCopyQueueInit(ZephyrZeroCopyQueue_t *queue, size_t msgSize,
+                            size_t maxMsgCnt)
+{
+  int rc;
+  char *poolBuffer;
+  char *ptrBuffer;
+
+  poolBuffer = k_malloc(ZEPHYR_ZERO_COPY_BLOCK_SIZE(msgSize) * maxMsgCnt);
+  if(!poolBuffer)
+  {
+    LOG_ERR("unable to allocate the zero-copy queue pool");
+    return -ENOSPC;
+  }
+
+  ptrBuffer = k_malloc(sizeof(void *) * maxMsgCnt);
+  if(!ptrBuffer)
+  {
+    LOG_ERR("unable to allocate the zero-copy queue");
+    k_free(poolBuffer);
+    return -ENOSPC;
+  }
+
+  rc = zephyrZeroCopyQueueInitStatic(queue, poolBuffer, ptrBuffer, msgSize,
+    maxMsgCnt);
+  if(rc < 0)
+  {
+    k_free(ptrBuffer);
+    k_free(poolBuffer);
+  }
+
+  return rc;
+}
+
+int zephyrZeroCopyQueueInitStatic(ZephyrZeroCopyQueue_t *queue,
+                                  char *poolBuffer, char *ptrBuffer,
+                                  size_t msgSize, size_t maxMsgCnt)
+{
+  int rc;
+
+  rc = k_mem_slab_init(&queue->pool, poolBuffer,
+    ZEPHYR_ZERO_COPY_BLOCK_SIZE(msgSize), maxMsgCnt);
+  if(rc < 0)
+  {
+    LOG_ERR("unable to initialize the zero-copy queue pool");
+    return rc;
+  }
+
+  rc = zephyrMsgQueueInitStatic(&queue->queue, ptrBuffer, sizeof(void *),
+    maxMsgCnt);
+  if(rc < 0)
+  {
+    LOG_ERR("unable to initialize the zero-copy queue");
+    return rc;
+  }
+
+  queue->poolBuffer = poolBuffer;
+  atomic_clear(&queue->peakUsedBlocks);
+  atomic_clear(&queue->allocFailures);
+
+  return 0;
+}
+
+int zephyrZeroCopyQueueAlloc(ZephyrZeroCopyQueue_t *queue, void **msg,
+                             uint32_t timeout, ZephyrTimeUnit_t timeUnit)
+{
+  int rc;
+
+  rc = k_mem_slab_alloc(&queue->pool, msg,
+    zephyrCommonProcessTimeout(timeout, timeUnit));
+  if(rc < 0)
+  {
+    atomic_inc(&queue->allocFailures);
+    return rc;
+  }
+
+  updatePeakUsage(queue);
+
+  return 0;
+}
+
+int zephyrZeroCopyQueueSend(ZephyrZeroCopyQueue_t *queue, void *msg,
+                            uint32_t timeout, ZephyrTimeUnit_t timeUnit)
+{
+  return zephyrMsgQueuePush(&queue->queue, &msg, timeout, timeUnit);
+}
+
+int zephyrZeroCopyQueueReceive(ZephyrZeroCopyQueue_t *queue, void **msg,
+                               uint32_t timeout, ZephyrTimeUnit_t timeUnit)
+{
+  return zephyrMsgQueuePop(&queue->queue, msg, timeout, timeUnit);
+}
+
+void zephyrZeroCopyQueueFree(ZephyrZeroCopyQueue_t *queue, void *msg)
+{
+  k_mem_slab_free(&queue->pool, msg);
+}
+
+void zephyrZeroCopyQueueGetStats(ZephyrZeroCopyQueue_t *queue,
+                                 ZephyrZeroCopyQueueStats_t *stats)
+{
+  stats->usedBlocks = k_mem_slab_num_used_get(&queue->pool);
+  stats->peakUsedBlocks = atomic_get(&queue->peakUsedBlocks);
+  stats->allocFailures = atomic_get(&queue->allocFailures);
+}
+
+/** @} */
@@ -0,0 +1,157 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrZeroCopyQueue.h
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Zero-Copy Message Queue Wrapper
+ *
+ *            This file is the declaration of the zero-copy message queue
+ *            wrapper. The producers allocate a block from the queue pool,
+ *            fill it in place and send it. Only the block pointer goes
+ *            through the queue, and the consumers free the block once done.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#ifndef ZERO_COPY_QUEUE_WRAPPER
+#define ZERO_COPY_QUEUE_WRAPPER
+
+#include <zephyr/kernel.h>
+
+#include "zephyrCommon.h"
+#include "zephyrMsgQueue.h"
+
+/**
+ * @brief   Get the pool block size of a message size.
+ *
+ * @param _msgSize    The message size.
+ */
+#define ZEPHYR_ZERO_COPY_BLOCK_SIZE(_msgSize)   ROUND_UP(_msgSize, sizeof(void *))
+
+/**
+ * @brief   Define the storage buffers of a zero-copy queue, sized and aligned
+ *          at build time. The buffers are named _name##Blocks and
+ *          _name##Ptrs and are passed to zephyrZeroCopyQueueInitStatic().
+ *
+ * @param _name       The buffers name prefix.
+ * @param _msgSize    The message size of the queue.
+ * @param _maxMsgCnt  The maximum message count of the queue.
+ */
+#define ZEPHYR_ZERO_COPY_QUEUE_BUFFERS_DEFINE(_name, _msgSize, _maxMsgCnt)    \
+  static char __aligned(sizeof(void *))                                       \
+    _name##Blocks[ZEPHYR_ZERO_COPY_BLOCK_SIZE(_msgSize) * (_maxMsgCnt)];      \
+  static ZEPHYR_MSG_QUEUE_BUFFER_DEFINE(_name##Ptrs, sizeof(void *),          \
+                                        _maxMsgCnt)
+
+/**
+ * @brief   The zero-copy message queue statistics.
+*/
+typedef struct
+{
+  uint32_t usedBlocks;              /**< The currently allocated block count. */
+  uint32_t peakUsedBlocks;          /**< The peak allocated block count. */
+  uint32_t allocFailures;           /**< The failed allocation count. */
+} ZephyrZeroCopyQueueStats_t;
+
+/**
+ * @brief   The zero-copy message queue data structure.
+*/
+typedef struct
+{
+  struct k_mem_slab pool;           /**< The message block pool. */
+  char *poolBuffer;                 /**< The message block pool buffer. */
+  ZephyrMsgQueue_t queue;           /**< The message pointer queue. */
+  atomic_t peakUsedBlocks;          /**< The peak allocated block count. */
+  atomic_t allocFailures;           /**< The failed allocation count. */
+} ZephyrZeroCopyQueue_t;
+
+/**
+ * @brief   Initialize a zero-copy message queue, allocating its storage.
+ *
+ * @param queue       The zero-copy queue.
+ * @param msgSize     The message size.
+ * @param maxMsgCnt   The maximum message count, the pool block count.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrZeroCopyQueueInit(ZephyrZeroCopyQueue_t *queue, size_t msgSize,
+                            size_t maxMsgCnt);
+
+/**
+ * @brief   Initialize a zero-copy message queue with caller provided storage,
+ *          usually defined with ZEPHYR_ZERO_COPY_QUEUE_BUFFERS_DEFINE.
+ *
+ * @param queue       The zero-copy queue.
+ * @param poolBuffer  The pool buffer of maxMsgCnt blocks.
+ * @param ptrBuffer   The pointer queue buffer of maxMsgCnt pointers.
+ * @param msgSize     The message size.
+ * @param maxMsgCnt   The maximum message count, the pool block count.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrZeroCopyQueueInitStatic(ZephyrZeroCopyQueue_t *queue,
+                                  char *poolBuffer, char *ptrBuffer,
+                                  size_t msgSize, size_t maxMsgCnt);
+
+/**
+ * @brief   Allocate a message block to fill in place.
+ *
+ * @param queue       The zero-copy queue.
+ * @param msg         The allocated message block.
+ * @param timeout     The waiting period if the pool is exhausted.
+ * @param timeUnit    The time unit of the timeout.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrZeroCopyQueueAlloc(ZephyrZeroCopyQueue_t *queue, void **msg,
+                             uint32_t timeout, ZephyrTimeUnit_t timeUnit);
+
+/**
+ * @brief   Send an allocated message block. The block belongs to the consumer
+ *          once sent.
+ *
+ * @param queue       The zero-copy queue.
+ * @param msg         The message block.
+ * @param timeout     The waiting period if the queue is full.
+ * @param timeUnit    The time unit of the timeout.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrZeroCopyQueueSend(ZephyrZeroCopyQueue_t *queue, void *msg,
+                            uint32_t timeout, ZephyrTimeUnit_t timeUnit);
+
+/**
+ * @brief   Receive a message block. The block must be freed once used.
+ *
+ * @param queue       The zero-copy queue.
+ * @param msg         The received message block.
+ * @param timeout     The waiting period if the queue is empty.
+ * @param timeUnit    The time unit of the timeout.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrZeroCopyQueueReceive(ZephyrZeroCopyQueue_t *queue, void **msg,
+                               uint32_t timeout, ZephyrTimeUnit_t timeUnit);
+
+/**
+ * @brief   Free a message block back to the pool.
+ *
+ * @param queue       The zero-copy queue.
+ * @param msg         The message block.
+ */
+void zephyrZeroCopyQueueFree(ZephyrZeroCopyQueue_t *queue, void *msg);
+
+/**
+ * @brief   Get the zero-copy queue pool statistics.
+ *
+ * @param queue       The zero-copy queue.
+ * @param stats       The queue statistics.
+ */
+void zephyrZeroCopyQueueGetStats(ZephyrZeroCopyQueue_t *queue,
+                                 ZephyrZeroCopyQueueStats_t *stats);
+
+#endif    /* ZERO_COPY_QUEUE_WRAPPER */
+
+/** @} */
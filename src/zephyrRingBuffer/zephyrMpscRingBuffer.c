@@ -0,0 +1,217 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrMpscRingBuffer.c
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Multiple Producer Single Consumer Ring Buffer Wrapper
+ *
+ *            This file is the implementation of the multiple producer single
+ *            consumer record ring. Each record starts with a 32 bits header
+ *            word holding its size, a commit flag and a padding flag. A
+ *            record never wraps, the end of the ring is skipped with a
+ *            padding record instead. The consumer clears the consumed area,
+ *            so a header is only ever seen committed once committed.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#include <string.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+#include "zephyrMpscRingBuffer.h"
+
+LOG_MODULE_DECLARE(ZEPHYR_WRAPPER_MODULE_NAME);
+
+/**
+ * @brief   The header commit flag.
+ */
+#define HEADER_COMMIT                 BIT(31)
+
+/**
+ * @brief   The header padding flag, the record only skips the ring end.
+ */
+#define HEADER_PAD                    BIT(30)
+
+/**
+ * @brief   The header size mask.
+ */
+#define HEADER_SIZE_MASK              (HEADER_PAD - 1)
+
+/**
+ * @brief   Get the ring space used by a record, header included.
+ *
+ * @param size        The record size.
+ *
+ * @return            The record span.
+ */
+static inline uint32_t getRecordSpan(uint32_t size)
+{
+  return ROUND_UP(sizeof(uint32_t) + size, sizeof(uint32_t));
+}
+
+/**
+ * @brief   Get the record header at a ring index.
+ *
+ * @param buffer      The MPSC ring buffer.
+ * @param index       The ring index.
+ *
+ * @return            The record header.
+ */
+static inline uint32_t *getHeader(ZephyrMpscRingBuffer_t *buffer,
+                                  uint32_t index)
+{
+  return (uint32_t *)(buffer->data + (index & buffer->mask));
+}
+
+int zephyrMpscRingBufInit(ZephyrMpscRingBuffer_t *buffer, size_t size,
+                          uint8_t *data)
+{
+  if(!data || !IS_ALIGNED(data, sizeof(uint32_t)) || size < 8 ||
+     !IS_POWER_OF_TWO(size) || size > (1U << 30))
+  {
+    LOG_ERR("invalid MPSC ring buffer storage");
+    return -EINVAL;
+  }
+
+  memset(data, 0, size);
+  buffer->data = data;
+  buffer->mask = size - 1;
+  atomic_clear(&buffer->head);
+  atomic_clear(&buffer->tail);
+
+  return 0;
+}
+
+int zephyrMpscRingBufReserve(ZephyrMpscRingBuffer_t *buffer, void **record,
+                             size_t size)
+{
+  uint32_t head;
+  uint32_t tail;
+  uint32_t span;
+  uint32_t padSpan;
+  uint32_t capacity = buffer->mask + 1;
+
+  if(size > HEADER_SIZE_MASK || getRecordSpan(size) > capacity)
+    return -EINVAL;
+
+  span = getRecordSpan(size);
+
+  do
+  {
+    head = (uint32_t)atomic_get(&buffer->head);
+    tail = (uint32_t)atomic_get(&buffer->tail);
+
+    /* a record running past the ring end starts over at the beginning. */
+    padSpan = capacity - (head & buffer->mask);
+    if(padSpan >= span)
+      padSpan = 0;
+
+    /* the padding can refuse a record longer than half the ring even
+     * when the ring is empty. */
+    if(head - tail + padSpan + span > capacity)
+      return -ENOSPC;
+  } while(!atomic_cas(&buffer->head, (atomic_val_t)head,
+                      (atomic_val_t)(head + padSpan + span)));
+
+  if(padSpan > 0)
+  {
+    __atomic_store_n(getHeader(buffer, head),
+      HEADER_COMMIT | HEADER_PAD | padSpan, __ATOMIC_RELEASE);
+    head += padSpan;
+  }
+
+  __atomic_store_n(getHeader(buffer, head), size, __ATOMIC_RELAXED);
+  *record = getHeader(buffer, head) + 1;
+
+  return 0;
+}
+
+void zephyrMpscRingBufCommit(ZephyrMpscRingBuffer_t *buffer, void *record)
+{
+  uint32_t *header = (uint32_t *)record - 1;
+
+  /* the record data must be visible before the commit flag. */
+  __atomic_store_n(header, *header | HEADER_COMMIT, __ATOMIC_RELEASE);
+}
+
+int zephyrMpscRingBufPut(ZephyrMpscRingBuffer_t *buffer, const void *data,
+                         size_t size)
+{
+  int rc;
+  void *record;
+
+  rc = zephyrMpscRingBufReserve(buffer, &record, size);
+  if(rc < 0)
+    return rc;
+
+  memcpy(record, data, size);
+  zephyrMpscRingBufCommit(buffer, record);
+
+  return 0;
+}
+
+int zephyrMpscRingBufClaim(ZephyrMpscRingBuffer_t *buffer, void **record)
+{
+  uint32_t header;
+  uint32_t *headerPtr;
+  uint32_t tail = (uint32_t)atomic_get(&buffer->tail);
+
+  for(;;)
+  {
+    headerPtr = getHeader(buffer, tail);
+    header = __atomic_load_n(headerPtr, __ATOMIC_ACQUIRE);
+
+    if(!(header & HEADER_COMMIT))
+      return -ENODATA;
+
+    if(!(header & HEADER_PAD))
+      break;
+
+    /* the area is cleared before the producers can reserve it again. */
+    memset(headerPtr, 0, header & HEADER_SIZE_MASK);
+    tail += header & HEADER_SIZE_MASK;
+    atomic_set(&buffer->tail, (atomic_val_t)tail);
+  }
+
+  *record = headerPtr + 1;
+
+  return header & HEADER_SIZE_MASK;
+}
+
+void zephyrMpscRingBufFinish(ZephyrMpscRingBuffer_t *buffer)
+{
+  uint32_t span;
+  uint32_t *headerPtr;
+  uint32_t tail = (uint32_t)atomic_get(&buffer->tail);
+
+  headerPtr = getHeader(buffer, tail);
+  span = getRecordSpan(*headerPtr & HEADER_SIZE_MASK);
+
+  /* the area is cleared before the producers can reserve it again. */
+  memset(headerPtr, 0, span);
+  atomic_set(&buffer->tail, (atomic_val_t)(tail + span));
+}
+
+int zephyrMpscRingBufGet(ZephyrMpscRingBuffer_t *buffer, void *data,
+                         size_t size)
+{
+  int recordSize;
+  void *record;
+
+  recordSize = zephyrMpscRingBufClaim(buffer, &record);
+  if(recordSize < 0)
+    return recordSize;
+
+  if((size_t)recordSize > size)
+    return -EMSGSIZE;
+
+  memcpy(data, record, recordSize);
+  zephyrMpscRingBufFinish(buffer);
+
+  return recordSize;
+}
+
+/** @} */
@@ -0,0 +1,135 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrMpscRingBuffer.h
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Multiple Producer Single Consumer Ring Buffer Wrapper
+ *
+ *            This file is the declaration of the multiple producer single
+ *            consumer record ring. The producers reserve their record with a
+ *            compare-and-swap on the reservation head, fill it concurrently
+ *            and commit it in any order. The consumer only sees the records
+ *            committed in front of the oldest pending one. No lock is held
+ *            while the records are filled.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#ifndef MPSC_RING_BUFFER_WRAPPER
+#define MPSC_RING_BUFFER_WRAPPER
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+/**
+ * @brief   Define a MPSC ring buffer data area. The size must be a power of
+ *          two.
+ *
+ * @param _name       The data area name.
+ * @param _size       The size of the ring buffer in bytes.
+ */
+#define ZEPHYR_MPSC_RING_BUF_DATA_DEFINE(_name, _size)                        \
+  BUILD_ASSERT(IS_POWER_OF_TWO(_size) && (_size) >= 8,                        \
+               "the MPSC ring buffer size must be a power of two");           \
+  uint8_t __aligned(sizeof(uint32_t)) _name[_size]
+
+/**
+ * @brief   The MPSC ring buffer data structure.
+ */
+typedef struct
+{
+  uint8_t *data;                    /**< The data area. */
+  uint32_t mask;                    /**< The index mask, the size minus 1. */
+  atomic_t head;                    /**< The reserved byte count. */
+  atomic_t tail;                    /**< The consumed byte count. */
+} ZephyrMpscRingBuffer_t;
+
+/**
+ * @brief   Initialize a MPSC ring buffer.
+ *
+ * @param buffer      The MPSC ring buffer.
+ * @param size        The size of the ring buffer in bytes, a power of two.
+ * @param data        The data area of the ring buffer, 4 bytes aligned.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrMpscRingBufInit(ZephyrMpscRingBuffer_t *buffer, size_t size,
+                          uint8_t *data);
+
+/**
+ * @brief   Reserve a record. Any producer, ISRs included, can reserve. The
+ *          record is filled in place, then committed. A record never wraps,
+ *          so a record spanning more than half the ring, its 4 bytes header
+ *          and alignment included, can fail with -ENOSPC even on an empty
+ *          ring when the end of the ring is too close.
+ *
+ * @param buffer      The MPSC ring buffer.
+ * @param record      The reserved record data.
+ * @param size        The record size.
+ *
+ * @return            0 if successful, -ENOSPC if the ring buffer is full,
+ *                    the error code otherwise.
+ */
+int zephyrMpscRingBufReserve(ZephyrMpscRingBuffer_t *buffer, void **record,
+                             size_t size);
+
+/**
+ * @brief   Commit a reserved record.
+ *
+ * @param buffer      The MPSC ring buffer.
+ * @param record      The reserved record data.
+ */
+void zephyrMpscRingBufCommit(ZephyrMpscRingBuffer_t *buffer, void *record);
+
+/**
+ * @brief   Put a record in a MPSC ring buffer. Like the reservation, a record
+ *          spanning more than half the ring can fail with -ENOSPC even on an
+ *          empty ring.
+ *
+ * @param buffer      The MPSC ring buffer.
+ * @param data        The record data.
+ * @param size        The record size.
+ *
+ * @return            0 if successful, -ENOSPC if the ring buffer is full,
+ *                    the error code otherwise.
+ */
+int zephyrMpscRingBufPut(ZephyrMpscRingBuffer_t *buffer, const void *data,
+                         size_t size);
+
+/**
+ * @brief   Claim the next committed record. Only the consumer may call it.
+ *
+ * @param buffer      The MPSC ring buffer.
+ * @param record      The claimed record data.
+ *
+ * @return            The record size if successful, -ENODATA if no committed
+ *                    record is available.
+ */
+int zephyrMpscRingBufClaim(ZephyrMpscRingBuffer_t *buffer, void **record);
+
+/**
+ * @brief   Release the claimed record to the producers.
+ *
+ * @param buffer      The MPSC ring buffer.
+ */
+void zephyrMpscRingBufFinish(ZephyrMpscRingBuffer_t *buffer);
+
+/**
+ * @brief   Get the next committed record. Only the consumer may call it.
+ *
+ * @param buffer      The MPSC ring buffer.
+ * @param data        The output buffer.
+ * @param size        The size of the output buffer.
+ *
+ * @return            The record size if successful, -ENODATA if no committed
+ *                    record is available, -EMSGSIZE if the output buffer is
+ *                    too small.
+ */
+int zephyrMpscRingBufGet(ZephyrMpscRingBuffer_t *buffer, void *data,
+                         size_t size);
+
+#endif    /* MPSC_RING_BUFFER_WRAPPER */
+
+/** @} */
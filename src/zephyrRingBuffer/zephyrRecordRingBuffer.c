@@ -0,0 +1,200 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrRecordRingBuffer.c
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Record Ring Buffer Wrapper
+ *
+ *            This file is the implementation of the record ring buffer.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#include <string.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include "zephyrRecordRingBuffer.h"
+
+LOG_MODULE_DECLARE(ZEPHYR_WRAPPER_MODULE_NAME);
+
+/**
+ * @brief   Copy data in claimed segments. The segments are advanced past the
+ *          copied data.
+ *
+ * @param segments  The claimed segments.
+ * @param data      The data.
+ * @param size      The data size.
+ */
+static void copyToSegments(ZephyrRingBufSegment_t segments[2],
+                           const uint8_t *data, size_t size)
+{
+  size_t chunk;
+
+  for(uint8_t i = 0; i < 2 && size > 0; ++i)
+  {
+    chunk = MIN(size, segments[i].size);
+    memcpy(segments[i].data, data, chunk);
+    segments[i].data += chunk;
+    segments[i].size -= chunk;
+    data += chunk;
+    size -= chunk;
+  }
+
+  if(segments[0].size == 0)
+  {
+    segments[0] = segments[1];
+    segments[1].size = 0;
+  }
+}
+
+/**
+ * @brief   Copy data from claimed segments. The segments are advanced past
+ *          the copied data.
+ *
+ * @param segments  The claimed segments.
+ * @param data      The output data, NULL to only skip the data.
+ * @param size      The data size.
+ */
+static void copyFromSegments(ZephyrRingBufSegment_t segments[2],
+                             uint8_t *data, size_t size)
+{
+  size_t chunk;
+
+  for(uint8_t i = 0; i < 2 && size > 0; ++i)
+  {
+    chunk = MIN(size, segments[i].size);
+    if(data)
+    {
+      memcpy(data, segments[i].data, chunk);
+      data += chunk;
+    }
+    segments[i].data += chunk;
+    segments[i].size -= chunk;
+    size -= chunk;
+  }
+
+  if(segments[0].size == 0)
+  {
+    segments[0] = segments[1];
+    segments[1].size = 0;
+  }
+}
+
+void zephyrRecordRingBufInit(ZephyrRecordRingBuffer_t *buffer, size_t size,
+                             uint8_t *data)
+{
+  zephyrRingBufInit(&buffer->ring, size, data);
+  buffer->dropCnt = 0;
+  buffer->claimSize = 0;
+}
+
+int zephyrRecordRingBufClaim(ZephyrRecordRingBuffer_t *buffer,
+                             ZephyrRingBufSegment_t segments[2], size_t size)
+{
+  uint8_t header[ZEPHYR_RECORD_HEADER_SIZE];
+
+  if(size > ZEPHYR_RECORD_MAX_SIZE || ZEPHYR_RECORD_HEADER_SIZE + size >
+     zephyrRingBufGetFreeSpace(&buffer->ring))
+  {
+    ++buffer->dropCnt;
+    return -ENOSPC;
+  }
+
+  zephyrRingBufClaimPuttingSegments(&buffer->ring, segments,
+    ZEPHYR_RECORD_HEADER_SIZE + size);
+
+  sys_put_le16(size, header);
+  copyToSegments(segments, header, ZEPHYR_RECORD_HEADER_SIZE);
+  buffer->claimSize = size;
+
+  return 0;
+}
+
+int zephyrRecordRingBufCommit(ZephyrRecordRingBuffer_t *buffer, size_t size)
+{
+  /* the header already holds the claimed size. */
+  if(size != buffer->claimSize)
+  {
+    LOG_ERR("record commit size %zu differs from its claim %zu", size,
+      buffer->claimSize);
+    return -EINVAL;
+  }
+
+  return zephyrRingBufFinishPutting(&buffer->ring,
+    ZEPHYR_RECORD_HEADER_SIZE + size);
+}
+
+int zephyrRecordRingBufPut(ZephyrRecordRingBuffer_t *buffer,
+                           const uint8_t *data, size_t size)
+{
+  int rc;
+  ZephyrRingBufSegment_t segments[2];
+
+  rc = zephyrRecordRingBufClaim(buffer, segments, size);
+  if(rc < 0)
+    return rc;
+
+  copyToSegments(segments, data, size);
+
+  return zephyrRecordRingBufCommit(buffer, size);
+}
+
+int zephyrRecordRingBufPeekLength(ZephyrRecordRingBuffer_t *buffer)
+{
+  uint8_t header[ZEPHYR_RECORD_HEADER_SIZE];
+
+  if(zephyrRingBufPeek(&buffer->ring, header, sizeof(header)) < sizeof(header))
+    return -ENODATA;
+
+  return sys_get_le16(header);
+}
+
+int zephyrRecordRingBufGet(ZephyrRecordRingBuffer_t *buffer, uint8_t *data,
+                           size_t size)
+{
+  int recordSize;
+  ZephyrRingBufSegment_t segments[2];
+
+  recordSize = zephyrRecordRingBufPeekLength(buffer);
+  if(recordSize < 0)
+    return recordSize;
+
+  if((size_t)recordSize > size)
+    return -EMSGSIZE;
+
+  zephyrRingBufClaimGettingSegments(&buffer->ring, segments,
+    ZEPHYR_RECORD_HEADER_SIZE + recordSize);
+  copyFromSegments(segments, NULL, ZEPHYR_RECORD_HEADER_SIZE);
+  copyFromSegments(segments, data, recordSize);
+  zephyrRingBufFinishGetting(&buffer->ring,
+    ZEPHYR_RECORD_HEADER_SIZE + recordSize);
+
+  return recordSize;
+}
+
+int zephyrRecordRingBufSkip(ZephyrRecordRingBuffer_t *buffer)
+{
+  int recordSize;
+  ZephyrRingBufSegment_t segments[2];
+
+  recordSize = zephyrRecordRingBufPeekLength(buffer);
+  if(recordSize < 0)
+    return recordSize;
+
+  zephyrRingBufClaimGettingSegments(&buffer->ring, segments,
+    ZEPHYR_RECORD_HEADER_SIZE + recordSize);
+
+  return zephyrRingBufFinishGetting(&buffer->ring,
+    ZEPHYR_RECORD_HEADER_SIZE + recordSize);
+}
+
+uint32_t zephyrRecordRingBufGetDropCount(ZephyrRecordRingBuffer_t *buffer)
+{
+  return buffer->dropCnt;
+}
+
+/** @} */
@@ -0,0 +1,140 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrRecordRingBuffer.h
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Record Ring Buffer Wrapper
+ *
+ *            This file is the declaration of the record ring buffer. Each
+ *            record is stored with a 2 bytes length header in front of its
+ *            payload, so the records keep their boundaries with no slot
+ *            padding. A record that does not fit is dropped whole: the new
+ *            record is refused and the stored records are kept.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#ifndef RECORD_RING_BUFFER_WRAPPER
+#define RECORD_RING_BUFFER_WRAPPER
+
+#include <zephyr/kernel.h>
+
+#include "zephyrRingBuffer.h"
+
+/**
+ * @brief   The record header size in bytes.
+ */
+#define ZEPHYR_RECORD_HEADER_SIZE       sizeof(uint16_t)
+
+/**
+ * @brief   The maximum record payload size in bytes.
+ */
+#define ZEPHYR_RECORD_MAX_SIZE          UINT16_MAX
+
+/**
+ * @brief   The record ring buffer data structure.
+ */
+typedef struct
+{
+  ZephyrRingBuffer_t ring;          /**< The byte ring buffer. */
+  uint32_t dropCnt;                 /**< The dropped record count. */
+  size_t claimSize;                 /**< The claimed record payload size. */
+} ZephyrRecordRingBuffer_t;
+
+/**
+ * @brief   Initialize a record ring buffer.
+ *
+ * @param buffer    The record ring buffer.
+ * @param size      The size of the ring buffer in bytes.
+ * @param data      The data area of the ring buffer.
+ */
+void zephyrRecordRingBufInit(ZephyrRecordRingBuffer_t *buffer, size_t size,
+                             uint8_t *data);
+
+/**
+ * @brief   Claim the space of a whole record. The payload is written in the
+ *          claimed segments, then committed with zephyrRecordRingBufCommit().
+ *          A record that does not fit is dropped, the stored records are
+ *          kept.
+ *
+ * @param buffer    The record ring buffer.
+ * @param segments  The claimed payload segments.
+ * @param size      The record payload size.
+ *
+ * @return  0 if successful, -ENOSPC if the record was dropped.
+ */
+int zephyrRecordRingBufClaim(ZephyrRecordRingBuffer_t *buffer,
+                             ZephyrRingBufSegment_t segments[2], size_t size);
+
+/**
+ * @brief   Commit a claimed record.
+ *
+ * @param buffer    The record ring buffer.
+ * @param size      The record payload size, as claimed.
+ *
+ * @return  0 if successful, -EINVAL if the size is not the claimed size, the
+ *          error code otherwise.
+ */
+int zephyrRecordRingBufCommit(ZephyrRecordRingBuffer_t *buffer, size_t size);
+
+/**
+ * @brief   Put a record in a record ring buffer. A record that does not fit
+ *          is dropped: the newest record, the one being put, is refused
+ *          with -ENOSPC and the oldest records are kept.
+ *
+ * @param buffer    The record ring buffer.
+ * @param data      The record payload.
+ * @param size      The record payload size.
+ *
+ * @return  0 if successful, -ENOSPC if the record was dropped, the error code
+ *          otherwise.
+ */
+int zephyrRecordRingBufPut(ZephyrRecordRingBuffer_t *buffer,
+                           const uint8_t *data, size_t size);
+
+/**
+ * @brief   Get the payload size of the next record.
+ *
+ * @param buffer    The record ring buffer.
+ *
+ * @return  The next record payload size if successful, -ENODATA if the
+ *          ring buffer is empty.
+ */
+int zephyrRecordRingBufPeekLength(ZephyrRecordRingBuffer_t *buffer);
+
+/**
+ * @brief   Get the next record from a record ring buffer.
+ *
+ * @param buffer    The record ring buffer.
+ * @param data      The output buffer.
+ * @param size      The size of the output buffer.
+ *
+ * @return  The record payload size if successful, -ENODATA if the ring
+ *          buffer is empty, -EMSGSIZE if the output buffer is too small.
+ */
+int zephyrRecordRingBufGet(ZephyrRecordRingBuffer_t *buffer, uint8_t *data,
+                           size_t size);
+
+/**
+ * @brief   Skip the next record of a record ring buffer.
+ *
+ * @param buffer    The record ring buffer.
+ *
+ * @return  0 if successful, -ENODATA if the ring buffer is empty.
+ */
+int zephyrRecordRingBufSkip(ZephyrRecordRingBuffer_t *buffer);
+
+/**
+ * @brief   Get the count of records dropped for lack of space.
+ *
+ * @param buffer    The record ring buffer.
+ *
+ * @return  The dropped record count.
+ */
+uint32_t zephyrRecordRingBufGetDropCount(ZephyrRecordRingBuffer_t *buffer);
+
+#endif    /* RECORD_RING_BUFFER_WRAPPER */
+
+/** @} */
@@ -12,6 +12,7 @@
  * @{
  */
 
+#include <string.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/util.h>
 
@@ -20,71 +21,353 @@
 
 LOG_MODULE_DECLARE(ZEPHYR_WRAPPER_MODULE_NAME);
 
+#ifdef CONFIG_ENYA_RING_BUFFER_STATS
+/**
+ * @brief   Get the used space before an operation, for the statistics.
+ *
+ * @param buffer  The ring buffer.
+ *
+ * @return  The used space in bytes.
+ */
+static inline size_t statsUsed(ZephyrRingBuffer_t *buffer)
+{
+  return ring_buf_size_get(&buffer->ring);
+}
+
+/**
+ * @brief   Record data put in the ring buffer statistics and fire the high
+ *          watermark on its crossing.
+ *
+ * @param buffer      The ring buffer.
+ * @param usedBefore  The used space before the put, the oldest bytes
+ *                    discarded in overwrite mode included.
+ * @param size        The size put.
+ */
+static void recordPut(ZephyrRingBuffer_t *buffer, size_t usedBefore,
+                      size_t size)
+{
+  size_t used = ring_buf_size_get(&buffer->ring);
+
+  buffer->stats.bytesIn += size;
+  buffer->stats.peakUsed = MAX(buffer->stats.peakUsed, used);
+
+  if(buffer->watermarkCb && usedBefore < buffer->highMark &&
+     used >= buffer->highMark)
+    buffer->watermarkCb(buffer, RING_BUF_WATERMARK_HIGH,
+      buffer->watermarkData);
+}
+
+/**
+ * @brief   Record data got in the ring buffer statistics and fire the low
+ *          watermark on its crossing.
+ *
+ * @param buffer      The ring buffer.
+ * @param usedBefore  The used space before the get.
+ * @param size        The size got.
+ */
+static void recordGet(ZephyrRingBuffer_t *buffer, size_t usedBefore,
+                      size_t size)
+{
+  size_t used = ring_buf_size_get(&buffer->ring);
+
+  buffer->stats.bytesOut += size;
+
+  if(buffer->watermarkCb && usedBefore > buffer->lowMark &&
+     used <= buffer->lowMark)
+    buffer->watermarkCb(buffer, RING_BUF_WATERMARK_LOW,
+      buffer->watermarkData);
+}
+#else
+static inline size_t statsUsed(ZephyrRingBuffer_t *buffer)
+{
+  return 0;
+}
+
+static inline void recordPut(ZephyrRingBuffer_t *buffer, size_t usedBefore,
+                             size_t size)
+{
+}
+
+static inline void recordGet(ZephyrRingBuffer_t *buffer, size_t usedBefore,
+                             size_t size)
+{
+}
+#endif
+
+/**
+ * @brief   Reverse bytes in place.
+ *
+ * @param data  The bytes.
+ * @param size  The byte count.
+ */
+static void reverseBytes(uint8_t *data, size_t size)
+{
+  uint8_t tmp;
+
+  for(size_t i = 0, j = size; i + 1 < j; ++i)
+  {
+    --j;
+    tmp = data[i];
+    data[i] = data[j];
+    data[j] = tmp;
+  }
+}
+
 void zephyrRingBufInit(ZephyrRingBuffer_t *buffer, size_t size, uint8_t *data)
 {
-  ring_buf_init(buffer, size, data);
+  ring_buf_init(&buffer->ring, size, data);
+  buffer->overwrite = false;
+#ifdef CONFIG_ENYA_RING_BUFFER_STATS
+  memset(&buffer->stats, 0, sizeof(buffer->stats));
+  buffer->watermarkCb = NULL;
+#endif
+}
+
+void zephyrRingBufSetOverwrite(ZephyrRingBuffer_t *buffer, bool overwrite)
+{
+  buffer->overwrite = overwrite;
 }
 
 bool zephyrRingBufIsEmpty(ZephyrRingBuffer_t *buffer)
 {
-  return ring_buf_is_empty(buffer);
+  return ring_buf_is_empty(&buffer->ring);
 }
 
 void zephyrRingBufReset(ZephyrRingBuffer_t *buffer)
 {
-  ring_buf_reset(buffer);
+  ring_buf_reset(&buffer->ring);
 }
 
 size_t zephyrRingBufGetFreeSpace(ZephyrRingBuffer_t *buffer)
 {
-  return ring_buf_space_get(buffer);
+  return ring_buf_space_get(&buffer->ring);
 }
 
 size_t zephyrRingBufGetSize(ZephyrRingBuffer_t *buffer)
 {
-  return ring_buf_capacity_get(buffer);
+  return ring_buf_capacity_get(&buffer->ring);
 }
 
 size_t zephyrRingBufGetUsedSpace(ZephyrRingBuffer_t *buffer)
 {
-  return ring_buf_size_get(buffer);
+  return ring_buf_size_get(&buffer->ring);
 }
 
 size_t zephyrRingBufClaimPutting(ZephyrRingBuffer_t *buffer, uint8_t **data,
                                     size_t size)
 {
-  return ring_buf_put_claim(buffer, data, size);
+  return ring_buf_put_claim(&buffer->ring, data, size);
 }
 
 int zephyrRingBufFinishPutting(ZephyrRingBuffer_t *buffer, size_t size)
 {
-  return ring_buf_put_finish(buffer, size);
+  int rc;
+  size_t usedBefore = statsUsed(buffer);
+
+  rc = ring_buf_put_finish(&buffer->ring, size);
+  if(rc == 0)
+    recordPut(buffer, usedBefore, size);
+
+  return rc;
+}
+
+size_t zephyrRingBufClaimPuttingSegments(ZephyrRingBuffer_t *buffer,
+                                         ZephyrRingBufSegment_t segments[2],
+                                         size_t size)
+{
+  /* the claims add up until finished, the second one starts at the wrap. */
+  segments[0].size = ring_buf_put_claim(&buffer->ring, &segments[0].data,
+    size);
+  segments[1].data = NULL;
+  segments[1].size = 0;
+
+  if(segments[0].size < size)
+    segments[1].size = ring_buf_put_claim(&buffer->ring, &segments[1].data,
+      size - segments[0].size);
+
+  return segments[0].size + segments[1].size;
 }
 
 size_t zephyrRingBufPut(ZephyrRingBuffer_t *buffer, uint8_t *data, size_t size)
 {
-  return ring_buf_put(buffer, data, size);
+  size_t putSize;
+  size_t usedBefore = statsUsed(buffer);
+  size_t capacity;
+  size_t freeSpace;
+
+  if(buffer->overwrite)
+  {
+    capacity = ring_buf_capacity_get(&buffer->ring);
+    if(size > capacity)
+    {
+      data += size - capacity;
+      size = capacity;
+    }
+
+    /* a NULL output discards the oldest bytes. */
+    freeSpace = ring_buf_space_get(&buffer->ring);
+    if(size > freeSpace)
+      ring_buf_get(&buffer->ring, NULL, size - freeSpace);
+  }
+
+  putSize = ring_buf_put(&buffer->ring, data, size);
+  recordPut(buffer, usedBefore, putSize);
+#ifdef CONFIG_ENYA_RING_BUFFER_STATS
+  if(putSize < size)
+    ++buffer->stats.shortPutCnt;
+#endif
+
+  return putSize;
 }
 
 size_t zephyrRingBufClaimGetting(ZephyrRingBuffer_t *buffer, uint8_t **data,
                                  size_t size)
 {
-  return ring_buf_get_claim(buffer, data, size);
+  return ring_buf_get_claim(&buffer->ring, data, size);
 }
 
 int zephyrRingBufFinishGetting(ZephyrRingBuffer_t *buffer, size_t size)
 {
-  return ring_buf_get_finish(buffer, size);
+  int rc;
+
+  /* the claim already counts the claimed data as free, so the usage before
+   * the get is only known once finished. */
+  rc = ring_buf_get_finish(&buffer->ring, size);
+  if(rc == 0)
+    recordGet(buffer, statsUsed(buffer) + size, size);
+
+  return rc;
+}
+
+size_t zephyrRingBufClaimGettingSegments(ZephyrRingBuffer_t *buffer,
+                                         ZephyrRingBufSegment_t segments[2],
+                                         size_t size)
+{
+  /* the claims add up until finished, the second one starts at the wrap. */
+  segments[0].size = ring_buf_get_claim(&buffer->ring, &segments[0].data,
+    size);
+  segments[1].data = NULL;
+  segments[1].size = 0;
+
+  if(segments[0].size < size)
+    segments[1].size = ring_buf_get_claim(&buffer->ring, &segments[1].data,
+      size - segments[0].size);
+
+  return segments[0].size + segments[1].size;
 }
 
 size_t zephyrRingBufGet(ZephyrRingBuffer_t *buffer, uint8_t *data, size_t size)
 {
-  return ring_buf_get(buffer, data, size);
+  size_t getSize;
+  size_t usedBefore = statsUsed(buffer);
+
+  getSize = ring_buf_get(&buffer->ring, data, size);
+  recordGet(buffer, usedBefore, getSize);
+
+  return getSize;
 }
 
 size_t zephyrRingBufPeek(ZephyrRingBuffer_t *buffer, uint8_t *data, size_t size)
 {
-  return ring_buf_peek(buffer, data, size);
+  return ring_buf_peek(&buffer->ring, data, size);
+}
+
+size_t zephyrRingBufSnapshot(ZephyrRingBuffer_t *buffer, uint8_t *data,
+                             size_t size)
+{
+  ZephyrRingBufSegment_t segments[2];
+  size_t used;
+  size_t skip;
+  size_t copySize = 0;
+
+  used = zephyrRingBufClaimGettingSegments(buffer, segments,
+    ring_buf_size_get(&buffer->ring));
+  skip = used > size ? used - size : 0;
+
+  for(uint8_t i = 0; i < ARRAY_SIZE(segments); ++i)
+  {
+    if(skip >= segments[i].size)
+    {
+      skip -= segments[i].size;
+      continue;
+    }
+
+    memcpy(data + copySize, segments[i].data + skip, segments[i].size - skip);
+    copySize += segments[i].size - skip;
+    skip = 0;
+  }
+
+  /* finishing with no size only releases the claim. */
+  ring_buf_get_finish(&buffer->ring, 0);
+
+  return copySize;
+}
+
+uint8_t *zephyrRingBufLinearize(ZephyrRingBuffer_t *buffer, size_t *size)
+{
+  ZephyrRingBufSegment_t segments[2];
+  uint8_t *area = buffer->ring.buffer;
+  size_t capacity = ring_buf_capacity_get(&buffer->ring);
+  size_t start;
+  uint8_t *data;
+
+  *size = zephyrRingBufClaimGettingSegments(buffer, segments,
+    ring_buf_size_get(&buffer->ring));
+  if(*size == 0)
+  {
+    ring_buf_reset(&buffer->ring);
+    return area;
+  }
+
+  /* rotate the whole area left by the content start with three reversals. */
+  start = segments[0].data - area;
+  if(start > 0)
+  {
+    reverseBytes(area, start);
+    reverseBytes(area + start, capacity - start);
+    reverseBytes(area, capacity);
+  }
+
+  /* restart the indexes from the area start, the content stays in place. */
+  ring_buf_reset(&buffer->ring);
+  ring_buf_put_claim(&buffer->ring, &data, *size);
+  ring_buf_put_finish(&buffer->ring, *size);
+
+  return data;
+}
+
+#ifdef CONFIG_ENYA_RING_BUFFER_STATS
+void zephyrRingBufGetStats(ZephyrRingBuffer_t *buffer,
+                           ZephyrRingBufStats_t *stats)
+{
+  *stats = buffer->stats;
+}
+
+void zephyrRingBufResetStats(ZephyrRingBuffer_t *buffer)
+{
+  memset(&buffer->stats, 0, sizeof(buffer->stats));
+  buffer->stats.peakUsed = ring_buf_size_get(&buffer->ring);
+}
+
+int zephyrRingBufSetWatermarks(ZephyrRingBuffer_t *buffer, size_t lowMark,
+                               size_t highMark,
+                               ZephyrRingBufWatermarkCb_t callback,
+                               void *userData)
+{
+  if(callback && (lowMark >= highMark ||
+     highMark > ring_buf_capacity_get(&buffer->ring)))
+  {
+    LOG_ERR("invalid ring buffer watermarks %zu/%zu", lowMark, highMark);
+    return -EINVAL;
+  }
+
+  buffer->lowMark = lowMark;
+  buffer->highMark = highMark;
+  buffer->watermarkData = userData;
+  buffer->watermarkCb = callback;
+
+  return 0;
 }
+#endif
 
 /** @} */
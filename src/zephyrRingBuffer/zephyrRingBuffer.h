@@ -17,10 +17,65 @@
 
 #include <zephyr/sys/ring_buffer.h>
 
+#ifdef CONFIG_ENYA_RING_BUFFER_STATS
+/**
+ * @brief The ring buffer statistics.
+*/
+typedef struct
+{
+  uint32_t peakUsed;                /**< The peak used space in bytes. */
+  uint32_t shortPutCnt;             /**< The count of partial puts. */
+  uint64_t bytesIn;                 /**< The total byte count put. */
+  uint64_t bytesOut;                /**< The total byte count got. */
+} ZephyrRingBufStats_t;
+
+/**
+ * @brief The ring buffer watermark events.
+*/
+typedef enum
+{
+  RING_BUF_WATERMARK_HIGH,          /**< The used space rose to the high mark. */
+  RING_BUF_WATERMARK_LOW,           /**< The used space fell to the low mark. */
+} ZephyrRingBufWatermark_t;
+
+struct ZephyrRingBuffer;
+
+/**
+ * @brief The ring buffer watermark callback.
+ *
+ * @param buffer    The ring buffer.
+ * @param event     The watermark crossed.
+ * @param userData  The callback user data.
+*/
+typedef void (*ZephyrRingBufWatermarkCb_t)(struct ZephyrRingBuffer *buffer,
+                                           ZephyrRingBufWatermark_t event,
+                                           void *userData);
+#endif
+
 /**
  * @brief The ring buffer type.
 */
-typedef struct ring_buf ZephyrRingBuffer_t;
+typedef struct ZephyrRingBuffer
+{
+  struct ring_buf ring;             /**< The zephyr ring buffer. */
+  bool overwrite;                   /**< The overwrite mode flag. */
+#ifdef CONFIG_ENYA_RING_BUFFER_STATS
+  ZephyrRingBufStats_t stats;       /**< The ring buffer statistics. */
+  size_t lowMark;                   /**< The low watermark in bytes. */
+  size_t highMark;                  /**< The high watermark in bytes. */
+  ZephyrRingBufWatermarkCb_t watermarkCb;   /**< The watermark callback. */
+  void *watermarkData;              /**< The watermark callback user data. */
+#endif
+} ZephyrRingBuffer_t;
+
+/**
+ * @brief The ring buffer segment, a contiguous part of a claimed area.
+*/
+typedef struct
+{
+  uint8_t *data;                    /**< The segment data. */
+  size_t size;                      /**< The segment size in bytes. */
+} ZephyrRingBufSegment_t;
 
 /**
  * @brief   Initialize a byte ring buffer.
@@ -31,6 +86,18 @@ typedef struct ring_buf ZephyrRingBuffer_t;
  */
 void zephyrRingBufInit(ZephyrRingBuffer_t *buffer, size_t size, uint8_t *data);
 
+/**
+ * @brief   Set the ring buffer overwrite mode. In overwrite mode, putting
+ *          data always succeeds by discarding the oldest bytes, which makes
+ *          the buffer a history of the latest data. Discarding moves the
+ *          consumer indices, so an overwriting put must be serialized with
+ *          the gets, and must not run while a get claim is outstanding.
+ *
+ * @param buffer    The ring buffer.
+ * @param overwrite The overwrite mode flag.
+ */
+void zephyrRingBufSetOverwrite(ZephyrRingBuffer_t *buffer, bool overwrite);
+
 /**
  * @brief   Check if a ring buffer is empty.
  *
@@ -99,14 +166,36 @@ size_t zephyrRingBufClaimPutting(ZephyrRingBuffer_t *buffer, uint8_t **data,
 int zephyrRingBufFinishPutting(ZephyrRingBuffer_t *buffer, size_t size);
 
 /**
- * @brief   Put data in a ring buffer.
+ * @brief   Claim a ring buffer for putting, across the wrap point. The
+ *          claimed area is returned as up to two segments, the second one
+ *          being empty if the area does not wrap. The putting operation is
+ *          finished with zephyrRingBufFinishPutting() for the total size put
+ *          in both segments.
+ *
+ * @param buffer    The ring buffer.
+ * @param segments  The claimed segments.
+ * @param size      The size of the data area to claim.
+ *
+ * @return  The total size of the claimed segments, which may be smaller than
+ *          the requested one.
+ */
+size_t zephyrRingBufClaimPuttingSegments(ZephyrRingBuffer_t *buffer,
+                                         ZephyrRingBufSegment_t segments[2],
+                                         size_t size);
+
+/**
+ * @brief   Put data in a ring buffer. In overwrite mode, the oldest bytes are
+ *          discarded to make room for the data, and only the last bytes are
+ *          kept when the data is larger than the buffer. In overwrite mode, the
+ *          caller serializes the put with the consumer, see
+ *          zephyrRingBufSetOverwrite.
  *
  * @param buffer  The ring buffer.
  * @param data    The data.
  * @param size    The size of the data.
  *
  * @return  The size of the data that was really put in the buffer. Which can
- *          be smaller than the size of the data.
+ *          be smaller than the size of the data, except in overwrite mode.
  */
 size_t zephyrRingBufPut(ZephyrRingBuffer_t *buffer, uint8_t *data, size_t size);
 
@@ -133,6 +222,24 @@ size_t zephyrRingBufClaimGetting(ZephyrRingBuffer_t *buffer, uint8_t **data,
  */
 int zephyrRingBufFinishGetting(ZephyrRingBuffer_t *buffer, size_t size);
 
+/**
+ * @brief   Claim a ring buffer for getting data, across the wrap point. The
+ *          claimed area is returned as up to two segments, the second one
+ *          being empty if the area does not wrap. The getting operation is
+ *          finished with zephyrRingBufFinishGetting() for the total size got
+ *          from both segments.
+ *
+ * @param buffer    The ring buffer.
+ * @param segments  The claimed segments.
+ * @param size      The size of the data area to claim.
+ *
+ * @return  The total size of the claimed segments, which may be smaller than
+ *          the requested one.
+ */
+size_t zephyrRingBufClaimGettingSegments(ZephyrRingBuffer_t *buffer,
+                                         ZephyrRingBufSegment_t segments[2],
+                                         size_t size);
+
 /**
  * @brief   Get data from a ring buffer.
  *
@@ -158,6 +265,72 @@ size_t zephyrRingBufGet(ZephyrRingBuffer_t *buffer, uint8_t *data, size_t size);
  */
 size_t zephyrRingBufPeek(ZephyrRingBuffer_t *buffer, uint8_t *data, size_t size);
 
+/**
+ * @brief   Copy the newest bytes of a ring buffer in a caller buffer, oldest
+ *          first, without consuming them. The snapshot claims and releases
+ *          the data through the consumer indices, so the caller serializes it
+ *          with the gets, and no get claim may be outstanding.
+ *
+ * @param buffer  The ring buffer.
+ * @param data    The output buffer.
+ * @param size    The size of the output buffer.
+ *
+ * @return  The size of the data copied.
+ */
+size_t zephyrRingBufSnapshot(ZephyrRingBuffer_t *buffer, uint8_t *data,
+                             size_t size);
+
+/**
+ * @brief   Rotate the ring buffer content in place so it is contiguous at the
+ *          start of the data area. The content is not consumed and the buffer
+ *          stays usable. No put or get can run during the rotation.
+ *
+ * @param buffer  The ring buffer.
+ * @param size    The size of the content.
+ *
+ * @return  The contiguous content.
+ */
+uint8_t *zephyrRingBufLinearize(ZephyrRingBuffer_t *buffer, size_t *size);
+
+#ifdef CONFIG_ENYA_RING_BUFFER_STATS
+/**
+ * @brief   Get a snapshot of the ring buffer statistics.
+ *
+ * @param buffer  The ring buffer.
+ * @param stats   The ring buffer statistics.
+ */
+void zephyrRingBufGetStats(ZephyrRingBuffer_t *buffer,
+                           ZephyrRingBufStats_t *stats);
+
+/**
+ * @brief   Reset the ring buffer statistics. The peak usage restarts from the
+ *          current usage.
+ *
+ * @param buffer  The ring buffer.
+ */
+void zephyrRingBufResetStats(ZephyrRingBuffer_t *buffer);
+
+/**
+ * @brief   Set the ring buffer watermarks. The callback is called from the
+ *          put that makes the used space rise to the high mark, and from the
+ *          get that makes it fall to the low mark. It runs in the context of
+ *          that put or get, under any lock its caller holds, like the lock
+ *          of a synchronized ring buffer.
+ *
+ * @param buffer    The ring buffer.
+ * @param lowMark   The low watermark in bytes.
+ * @param highMark  The high watermark in bytes.
+ * @param callback  The watermark callback, NULL to disable it.
+ * @param userData  The callback user data.
+ *
+ * @return  0 if successful, the error code otherwise.
+ */
+int zephyrRingBufSetWatermarks(ZephyrRingBuffer_t *buffer, size_t lowMark,
+                               size_t highMark,
+                               ZephyrRingBufWatermarkCb_t callback,
+                               void *userData);
+#endif
+
 #endif    /* RING_BUFFER_WRAPPER */
 
 /** @} */
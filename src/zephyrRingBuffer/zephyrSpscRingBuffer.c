@@ -0,0 +1,120 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrSpscRingBuffer.c
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Single Producer Single Consumer Ring Buffer Wrapper
+ *
+ *            This file is the implementation of the single producer single
+ *            consumer byte ring.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#include <string.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+#include "zephyrSpscRingBuffer.h"
+
+LOG_MODULE_DECLARE(ZEPHYR_WRAPPER_MODULE_NAME);
+
+/**
+ * @brief   Copy data out of the ring, splitting the copy at the wrap.
+ *
+ * @param buffer      The SPSC ring buffer.
+ * @param tail        The tail of the data to copy.
+ * @param data        The output buffer.
+ * @param size        The size of the data to copy.
+ */
+static void copyFromRing(ZephyrSpscRingBuffer_t *buffer, uint32_t tail,
+                         uint8_t *data, size_t size)
+{
+  uint32_t offset = tail & buffer->mask;
+  size_t chunk = MIN(size, (size_t)buffer->mask + 1 - offset);
+
+  memcpy(data, buffer->data + offset, chunk);
+  memcpy(data + chunk, buffer->data, size - chunk);
+}
+
+int zephyrSpscRingBufInit(ZephyrSpscRingBuffer_t *buffer, size_t size,
+                          uint8_t *data)
+{
+  if(!data || !IS_POWER_OF_TWO(size) || size > (1U << 31))
+  {
+    LOG_ERR("invalid SPSC ring buffer size %zu, must be a power of two",
+      size);
+    return -EINVAL;
+  }
+
+  buffer->data = data;
+  buffer->mask = size - 1;
+  atomic_clear(&buffer->head);
+  atomic_clear(&buffer->tail);
+
+  return 0;
+}
+
+size_t zephyrSpscRingBufPut(ZephyrSpscRingBuffer_t *buffer,
+                            const uint8_t *data, size_t size)
+{
+  uint32_t head = (uint32_t)atomic_get(&buffer->head);
+  uint32_t tail = (uint32_t)atomic_get(&buffer->tail);
+  uint32_t offset = head & buffer->mask;
+  size_t chunk;
+
+  size = MIN(size, (size_t)buffer->mask + 1 - (head - tail));
+  chunk = MIN(size, (size_t)buffer->mask + 1 - offset);
+
+  memcpy(buffer->data + offset, data, chunk);
+  memcpy(buffer->data, data + chunk, size - chunk);
+
+  /* the data must be visible before the consumer sees the new head. */
+  atomic_set(&buffer->head, (atomic_val_t)(head + size));
+
+  return size;
+}
+
+size_t zephyrSpscRingBufGet(ZephyrSpscRingBuffer_t *buffer, uint8_t *data,
+                            size_t size)
+{
+  uint32_t tail = (uint32_t)atomic_get(&buffer->tail);
+  uint32_t head = (uint32_t)atomic_get(&buffer->head);
+
+  size = MIN(size, (size_t)(head - tail));
+  copyFromRing(buffer, tail, data, size);
+
+  /* the data must be read before the producer can overwrite it. */
+  atomic_set(&buffer->tail, (atomic_val_t)(tail + size));
+
+  return size;
+}
+
+size_t zephyrSpscRingBufPeek(ZephyrSpscRingBuffer_t *buffer, uint8_t *data,
+                             size_t size)
+{
+  uint32_t tail = (uint32_t)atomic_get(&buffer->tail);
+  uint32_t head = (uint32_t)atomic_get(&buffer->head);
+
+  size = MIN(size, (size_t)(head - tail));
+  copyFromRing(buffer, tail, data, size);
+
+  return size;
+}
+
+size_t zephyrSpscRingBufGetUsedSpace(ZephyrSpscRingBuffer_t *buffer)
+{
+  uint32_t tail = (uint32_t)atomic_get(&buffer->tail);
+  uint32_t head = (uint32_t)atomic_get(&buffer->head);
+
+  return head - tail;
+}
+
+size_t zephyrSpscRingBufGetFreeSpace(ZephyrSpscRingBuffer_t *buffer)
+{
+  return (size_t)buffer->mask + 1 - zephyrSpscRingBufGetUsedSpace(buffer);
+}
+
+/** @} */
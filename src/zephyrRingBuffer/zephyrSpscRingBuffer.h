@@ -0,0 +1,119 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrSpscRingBuffer.h
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Single Producer Single Consumer Ring Buffer Wrapper
+ *
+ *            This file is the declaration of the single producer single
+ *            consumer byte ring. The head and tail are free running indices
+ *            kept in zephyr atomics, which order the data copies with the
+ *            index updates, so one producer and one consumer never need a
+ *            lock. The size is a power of two and the copies are split at
+ *            most once at the wrap.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#ifndef SPSC_RING_BUFFER_WRAPPER
+#define SPSC_RING_BUFFER_WRAPPER
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+/**
+ * @brief   Define a SPSC ring buffer data area. The size must be a power of
+ *          two.
+ *
+ * @param _name       The data area name.
+ * @param _size       The size of the ring buffer in bytes.
+ */
+#define ZEPHYR_SPSC_RING_BUF_DATA_DEFINE(_name, _size)                        \
+  uint8_t _name[_size];                                                       \
+  BUILD_ASSERT(IS_POWER_OF_TWO(_size),                                        \
+               "the SPSC ring buffer size must be a power of two")
+
+/**
+ * @brief   The SPSC ring buffer data structure.
+ */
+typedef struct
+{
+  uint8_t *data;                    /**< The data area. */
+  uint32_t mask;                    /**< The index mask, the size minus 1. */
+  atomic_t head;                    /**< The put byte count, producer owned. */
+  atomic_t tail;                    /**< The got byte count, consumer owned. */
+} ZephyrSpscRingBuffer_t;
+
+/**
+ * @brief   Initialize a SPSC ring buffer.
+ *
+ * @param buffer      The SPSC ring buffer.
+ * @param size        The size of the ring buffer in bytes, a power of two.
+ * @param data        The data area of the ring buffer.
+ *
+ * @return            0 if successful, the error code otherwise.
+ */
+int zephyrSpscRingBufInit(ZephyrSpscRingBuffer_t *buffer, size_t size,
+                          uint8_t *data);
+
+/**
+ * @brief   Put data in a SPSC ring buffer. Only the producer may call it.
+ *
+ * @param buffer      The SPSC ring buffer.
+ * @param data        The data.
+ * @param size        The size of the data.
+ *
+ * @return            The size of the data put in the buffer, which can be
+ *                    smaller than the size of the data.
+ */
+size_t zephyrSpscRingBufPut(ZephyrSpscRingBuffer_t *buffer,
+                            const uint8_t *data, size_t size);
+
+/**
+ * @brief   Get data from a SPSC ring buffer. Only the consumer may call it.
+ *
+ * @param buffer      The SPSC ring buffer.
+ * @param data        The output buffer.
+ * @param size        The size of the output buffer.
+ *
+ * @return            The size of the data got from the buffer.
+ */
+size_t zephyrSpscRingBufGet(ZephyrSpscRingBuffer_t *buffer, uint8_t *data,
+                            size_t size);
+
+/**
+ * @brief   Peek into a SPSC ring buffer without removing the data. Only the
+ *          consumer may call it.
+ *
+ * @param buffer      The SPSC ring buffer.
+ * @param data        The output buffer.
+ * @param size        The size of the output buffer.
+ *
+ * @return            The size of the data peeked from the buffer.
+ */
+size_t zephyrSpscRingBufPeek(ZephyrSpscRingBuffer_t *buffer, uint8_t *data,
+                             size_t size);
+
+/**
+ * @brief   Get the used space of a SPSC ring buffer.
+ *
+ * @param buffer      The SPSC ring buffer.
+ *
+ * @return            The used space in bytes.
+ */
+size_t zephyrSpscRingBufGetUsedSpace(ZephyrSpscRingBuffer_t *buffer);
+
+/**
+ * @brief   Get the free space of a SPSC ring buffer.
+ *
+ * @param buffer      The SPSC ring buffer.
+ *
+ * @return            The free space in bytes.
+ */
+size_t zephyrSpscRingBufGetFreeSpace(ZephyrSpscRingBuffer_t *buffer);
+
+#endif    /* SPSC_RING_BUFFER_WRAPPER */
+
+/** @} */
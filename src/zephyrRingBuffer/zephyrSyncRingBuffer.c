@@ -0,0 +1,176 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrSyncRingBuffer.c
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Synchronized Ring Buffer Wrapper
+ *
+ *            This file is the implementation of the synchronized ring buffer.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#include <zephyr/logging/log.h>
+
+#include "zephyrSyncRingBuffer.h"
+
+LOG_MODULE_DECLARE(ZEPHYR_WRAPPER_MODULE_NAME);
+
+void zephyrSyncRingBufInit(ZephyrSyncRingBuffer_t *buffer, size_t size,
+                           uint8_t *data)
+{
+  zephyrRingBufInit(&buffer->ring, size, data);
+  k_sem_init(&buffer->data, 0, 1);
+  k_sem_init(&buffer->space, 0, 1);
+  buffer->dataThreshold = 1;
+  buffer->spaceThreshold = 1;
+}
+
+int zephyrSyncRingBufSetThresholds(ZephyrSyncRingBuffer_t *buffer,
+                                   size_t dataThreshold,
+                                   size_t spaceThreshold)
+{
+  k_spinlock_key_t key;
+  size_t capacity = zephyrRingBufGetSize(&buffer->ring);
+
+  if(dataThreshold == 0 || dataThreshold > capacity ||
+     spaceThreshold == 0 || spaceThreshold > capacity)
+  {
+    LOG_ERR("invalid ring buffer thresholds %zu/%zu", dataThreshold,
+      spaceThreshold);
+    return -EINVAL;
+  }
+
+  key = k_spin_lock(&buffer->lock);
+  buffer->dataThreshold = dataThreshold;
+  buffer->spaceThreshold = spaceThreshold;
+  k_spin_unlock(&buffer->lock, key);
+
+  return 0;
+}
+
+size_t zephyrSyncRingBufPut(ZephyrSyncRingBuffer_t *buffer,
+                            const uint8_t *data, size_t size,
+                            uint32_t timeout, ZephyrTimeUnit_t timeUnit)
+{
+  size_t putSize = 0;
+  size_t usedBefore;
+  size_t usedAfter;
+  bool wakeReaders;
+  bool wakeWriters;
+  bool woken = false;
+  k_spinlock_key_t key;
+  k_timepoint_t end;
+
+  end = sys_timepoint_calc(zephyrCommonProcessTimeout(timeout, timeUnit));
+
+  for(;;)
+  {
+    key = k_spin_lock(&buffer->lock);
+    usedBefore = zephyrRingBufGetUsedSpace(&buffer->ring);
+    putSize += zephyrRingBufPut(&buffer->ring, (uint8_t *)data + putSize,
+      size - putSize);
+    usedAfter = zephyrRingBufGetUsedSpace(&buffer->ring);
+    wakeReaders = usedBefore < buffer->dataThreshold &&
+                  usedAfter >= buffer->dataThreshold;
+    wakeWriters = woken && zephyrRingBufGetFreeSpace(&buffer->ring) >=
+                  buffer->spaceThreshold;
+    k_spin_unlock(&buffer->lock, key);
+
+    if(wakeReaders)
+      k_sem_give(&buffer->data);
+    if(wakeWriters)
+      k_sem_give(&buffer->space);
+
+    if(putSize == size)
+      return putSize;
+
+    /* the ring is full, a signal left from an earlier crossing only
+     * causes another try. */
+    if(k_sem_take(&buffer->space, sys_timepoint_timeout(end)) < 0)
+      return putSize;
+    woken = true;
+  }
+}
+
+size_t zephyrSyncRingBufGet(ZephyrSyncRingBuffer_t *buffer, uint8_t *data,
+                            size_t size, uint32_t timeout,
+                            ZephyrTimeUnit_t timeUnit)
+{
+  size_t getSize;
+  size_t freeBefore;
+  size_t freeAfter;
+  bool wakeWriters;
+  bool wakeReaders;
+  bool woken = false;
+  k_spinlock_key_t key;
+  k_timepoint_t end;
+
+  end = sys_timepoint_calc(zephyrCommonProcessTimeout(timeout, timeUnit));
+
+  for(;;)
+  {
+    key = k_spin_lock(&buffer->lock);
+    freeBefore = zephyrRingBufGetFreeSpace(&buffer->ring);
+    getSize = zephyrRingBufGet(&buffer->ring, data, size);
+    freeAfter = zephyrRingBufGetFreeSpace(&buffer->ring);
+    wakeWriters = freeBefore < buffer->spaceThreshold &&
+                  freeAfter >= buffer->spaceThreshold;
+    wakeReaders = woken && zephyrRingBufGetUsedSpace(&buffer->ring) >=
+                  buffer->dataThreshold;
+    k_spin_unlock(&buffer->lock, key);
+
+    if(wakeWriters)
+      k_sem_give(&buffer->space);
+    if(wakeReaders)
+      k_sem_give(&buffer->data);
+
+    if(getSize > 0 || size == 0)
+      return getSize;
+
+    /* the ring is empty, a signal left from an earlier crossing only
+     * causes another try. */
+    if(k_sem_take(&buffer->data, sys_timepoint_timeout(end)) < 0)
+      return 0;
+    woken = true;
+  }
+}
+
+void zephyrSyncRingBufReset(ZephyrSyncRingBuffer_t *buffer)
+{
+  k_spinlock_key_t key = k_spin_lock(&buffer->lock);
+
+  zephyrRingBufReset(&buffer->ring);
+
+  k_spin_unlock(&buffer->lock, key);
+
+  k_sem_give(&buffer->space);
+}
+
+size_t zephyrSyncRingBufGetUsedSpace(ZephyrSyncRingBuffer_t *buffer)
+{
+  size_t used;
+  k_spinlock_key_t key = k_spin_lock(&buffer->lock);
+
+  used = zephyrRingBufGetUsedSpace(&buffer->ring);
+
+  k_spin_unlock(&buffer->lock, key);
+
+  return used;
+}
+
+size_t zephyrSyncRingBufGetFreeSpace(ZephyrSyncRingBuffer_t *buffer)
+{
+  size_t freeSpace;
+  k_spinlock_key_t key = k_spin_lock(&buffer->lock);
+
+  freeSpace = zephyrRingBufGetFreeSpace(&buffer->ring);
+
+  k_spin_unlock(&buffer->lock, key);
+
+  return freeSpace;
+}
+
+/** @} */
@@ -0,0 +1,130 @@
+/**
+ * Copyright (C) 2026 by Electronya
+ *
+ * @file      zephyrSyncRingBuffer.h
+ * @author    jbacon
+ * @date      2026-10-18
+ * @brief     Synchronized Ring Buffer Wrapper
+ *
+ *            This file is the declaration of the synchronized ring buffer.
+ *            The ring is protected by a spinlock and the readers and writers
+ *            can wait for data or space. The waiters are only signaled when
+ *            the used or free space crosses its wakeup threshold. A woken
+ *            waiter passes the signal on while the threshold is still met,
+ *            so one crossing wakes every blocked reader or writer in turn.
+ *            The non-waiting calls are ISR safe. The ring buffer watermark
+ *            callback runs with the ring lock held, it must not call back
+ *            into the synchronized ring buffer.
+ *
+ * @ingroup  zephyr-wrapper
+ * @{
+ */
+
+#ifndef SYNC_RING_BUFFER_WRAPPER
+#define SYNC_RING_BUFFER_WRAPPER
+
+#include <zephyr/kernel.h>
+
+#include "zephyrCommon.h"
+#include "zephyrRingBuffer.h"
+
+/**
+ * @brief   The synchronized ring buffer data structure.
+ */
+typedef struct
+{
+  ZephyrRingBuffer_t ring;          /**< The ring buffer. */
+  struct k_spinlock lock;           /**< The ring buffer lock. */
+  struct k_sem data;                /**< The data threshold crossing signal. */
+  struct k_sem space;               /**< The space threshold crossing signal. */
+  size_t dataThreshold;             /**< The used space waking the readers. */
+  size_t spaceThreshold;            /**< The free space waking the writers. */
+} ZephyrSyncRingBuffer_t;
+
+/**
+ * @brief   Initialize a synchronized ring buffer. Both wakeup thresholds
+ *          start at 1 byte.
+ *
+ * @param buffer      The synchronized ring buffer.
+ * @param size        The size of the ring buffer in bytes.
+ * @param data        The data area of the ring buffer.
+ */
+void zephyrSyncRingBufInit(ZephyrSyncRingBuffer_t *buffer, size_t size,
+                           uint8_t *data);
+
+/**
+ * @brief   Set the wakeup thresholds of a synchronized ring buffer.
+ *
+ * @param buffer          The synchronized ring buffer.
+ * @param dataThreshold   The used space waking the waiting readers.
+ * @param spaceThreshold  The free space waking the waiting writers.
+ *
+ * @return                0 if successful, the error code otherwise.
+ */
+int zephyrSyncRingBufSetThresholds(ZephyrSyncRingBuffer_t *buffer,
+                                   size_t dataThreshold,
+                                   size_t spaceThreshold);
+
+/**
+ * @brief   Put data in a synchronized ring buffer, waiting for space until
+ *          all the data is put or the timeout expires.
+ *
+ * @param buffer      The synchronized ring buffer.
+ * @param data        The data.
+ * @param size        The size of the data.
+ * @param timeout     The waiting period if the ring buffer is full.
+ * @param timeUnit    The time unit of the timeout.
+ *
+ * @return            The size of the data put in the buffer, which can be
+ *                    smaller than the size of the data.
+ */
+size_t zephyrSyncRingBufPut(ZephyrSyncRingBuffer_t *buffer,
+                            const uint8_t *data, size_t size,
+                            uint32_t timeout, ZephyrTimeUnit_t timeUnit);
+
+/**
+ * @brief   Get data from a synchronized ring buffer, waiting for data if it
+ *          is empty. The available data is returned without waiting for the
+ *          whole requested size.
+ *
+ * @param buffer      The synchronized ring buffer.
+ * @param data        The output buffer.
+ * @param size        The size of the output buffer.
+ * @param timeout     The waiting period if the ring buffer is empty.
+ * @param timeUnit    The time unit of the timeout.
+ *
+ * @return            The size of the data got from the buffer, 0 if the
+ *                    timeout expired.
+ */
+size_t zephyrSyncRingBufGet(ZephyrSyncRingBuffer_t *buffer, uint8_t *data,
+                            size_t size, uint32_t timeout,
+                            ZephyrTimeUnit_t timeUnit);
+
+/**
+ * @brief   Reset a synchronized ring buffer, waking the waiting writers.
+ *
+ * @param buffer      The synchronized ring buffer.
+ */
+void zephyrSyncRingBufReset(ZephyrSyncRingBuffer_t *buffer);
+
+/**
+ * @brief   Get the used space of a synchronized ring buffer.
+ *
+ * @param buffer      The synchronized ring buffer.
+ *
+ * @return            The used space in bytes.
+ */
+size_t zephyrSyncRingBufGetUsedSpace(ZephyrSyncRingBuffer_t *buffer);
+
+/**
+ * @brief   Get the free space of a synchronized ring buffer.
+ *
+ * @param buffer      The synchronized ring buffer.
+ *
+ * @return            The free space in bytes.
+ */
+size_t zephyrSyncRingBufGetFreeSpace(ZephyrSyncRingBuffer_t *buffer);
+
+#endif    /* SYNC_RING_BUFFER_WRAPPER */
+
+/** @} */
@@ -18,7 +18,7 @@
 
 LOG_MODULE_DECLARE(ZEPHYR_WRAPPER_MODULE_NAME);
 
-void zephyrThreadCreate(ZephyrThread_t *thread, char *name,
+void zephyrThreadCreate(ZephyrThread_t *thread, const char *name,
                         uint32_t startDelay, ZephyrTimeUnit_t timeUnit)
 {
   k_thread_create(&thread->data, thread->stack, thread->stackSize,
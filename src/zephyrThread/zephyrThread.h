@@ -15,6 +15,7 @@
 #ifndef THREAD_WRAPPER
 #define THREAD_WRAPPER
 
+#include <zephyr/init.h>
 #include <zephyr/kernel.h>
 
 #include "zephyrCommon.h"
@@ -35,6 +36,64 @@ typedef struct
   uint32_t options;                         /**< The thread options. */
 } ZephyrThread_t;
 
+/**
+ * @brief   Define a thread with its stack at build time. The thread is ready
+ *          to be created, no field needs to be set at runtime. Unlike the
+ *          K_THREAD_DEFINE threads, the descriptor holds the kernel thread
+ *          object, so the whole descriptor lives in RAM and none of the
+ *          configuration is kept in flash.
+ *
+ * @param _name       The thread name.
+ * @param _stackSize  The stack size.
+ * @param _entry      The thread entrypoint.
+ * @param _p1         The entrypoint first parameter.
+ * @param _p2         The entrypoint second parameter.
+ * @param _p3         The entrypoint third parameter.
+ * @param _priority   The thread priority.
+ * @param _options    The thread options.
+ */
+#define ZEPHYR_THREAD_DEFINE(_name, _stackSize, _entry, _p1, _p2, _p3,        \
+                             _priority, _options)                             \
+  static K_THREAD_STACK_DEFINE(_name##Stack, _stackSize);                     \
+  ZephyrThread_t _name = {                                                    \
+    .stack = _name##Stack,                                                    \
+    .stackSize = K_THREAD_STACK_SIZEOF(_name##Stack),                         \
+    .entry = _entry,                                                          \
+    .p1 = _p1,                                                                \
+    .p2 = _p2,                                                                \
+    .p3 = _p3,                                                                \
+    .priority = _priority,                                                    \
+    .options = _options,                                                      \
+  }
+
+/**
+ * @brief   Define a thread with its stack at build time and create it at the
+ *          application init level, like the zephyr static threads. The thread
+ *          name is the definition name.
+ *
+ * @param _name       The thread name.
+ * @param _stackSize  The stack size.
+ * @param _entry      The thread entrypoint.
+ * @param _p1         The entrypoint first parameter.
+ * @param _p2         The entrypoint second parameter.
+ * @param _p3         The entrypoint third parameter.
+ * @param _priority   The thread priority.
+ * @param _options    The thread options.
+ * @param _startDelay The thread start delay.
+ * @param _timeUnit   The time unit of the start delay.
+ */
+#define ZEPHYR_THREAD_AUTOSTART_DEFINE(_name, _stackSize, _entry, _p1, _p2,   \
+                                       _p3, _priority, _options, _startDelay, \
+                                       _timeUnit)                             \
+  ZEPHYR_THREAD_DEFINE(_name, _stackSize, _entry, _p1, _p2, _p3, _priority,   \
+                       _options);                                             \
+  static int _name##Autostart(void)                                           \
+  {                                                                           \
+    zephyrThreadCreate(&_name, #_name, _startDelay, _timeUnit);               \
+    return 0;                                                                 \
+  }                                                                           \
+  SYS_INIT(_name##Autostart, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY)
+
 /**
  * @brief   Create a thread.
  *
@@ -43,7 +102,7 @@ typedef struct
  * @param startDelay  The thread start delay.
  * @param timeUnit    The time unit of the start delay.
  */
-void zephyrThreadCreate(ZephyrThread_t *thread, char *name,
+void zephyrThreadCreate(ZephyrThread_t *thread, const char *name,
                         uint32_t startDelay, ZephyrTimeUnit_t timeUnit);
 
 /**
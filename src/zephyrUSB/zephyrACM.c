@@ -46,8 +46,8 @@ int zephyrAcmInit(ZephyrACM_t *acm, size_t rxBufSize, size_t txBufsize)
     return -ENOSPC;
   }
 
-  ring_buf_init(&acm->rxRingBuf, rxBufSize, acm->rxBuffer);
-  ring_buf_init(&acm->txRingBuf, txBufsize, acm->txBuffer);
+  zephyrRingBufInit(&acm->rxRingBuf, rxBufSize, acm->rxBuffer);
+  zephyrRingBufInit(&acm->txRingBuf, txBufsize, acm->txBuffer);
 
   rc = uart_irq_callback_set(acm->dev, acm->cb);
   if(rc < 0)
@@ -111,21 +111,29 @@ int zephyrAcmIsTxIrqReady(ZephyrACM_t *acm)
 int zephyrAcmReadFifo(ZephyrACM_t *acm)
 {
   int rc;
-  int rxByteCount;
-  uint8_t *freeHead;
-  size_t freeSpace;
+  int rxByteCount = 0;
+  int readCount;
+  ZephyrRingBufSegment_t segments[2];
 
-  freeSpace = ring_buf_space_get(&acm->rxRingBuf);
-  freeSpace = ring_buf_put_claim(&acm->rxRingBuf, &freeHead, freeSpace);
+  zephyrRingBufClaimPuttingSegments(&acm->rxRingBuf, segments,
+    zephyrRingBufGetFreeSpace(&acm->rxRingBuf));
 
-  rxByteCount = uart_fifo_read(acm->dev, freeHead, freeSpace);
-  if(rxByteCount < 0)
+  /* the second segment is only read if the fifo filled the first one. */
+  for(uint8_t i = 0; i < 2 && segments[i].size > 0; ++i)
   {
-    LOG_ERR("unable to read form the fifo");
-    rxByteCount = 0;
+    readCount = uart_fifo_read(acm->dev, segments[i].data, segments[i].size);
+    if(readCount < 0)
+    {
+      LOG_ERR("unable to read form the fifo");
+      break;
+    }
+
+    rxByteCount += readCount;
+    if((size_t)readCount < segments[i].size)
+      break;
   }
 
-  rc = ring_buf_put_finish(&acm->rxRingBuf, rxByteCount);
+  rc = zephyrRingBufFinishPutting(&acm->rxRingBuf, rxByteCount);
   if(rc < 0)
   {
     LOG_ERR("unable to transfer data from fifo to ring buffer");
@@ -138,22 +146,29 @@ int zephyrAcmReadFifo(ZephyrACM_t *acm)
 int zephyrAcmWriteFifo(ZephyrACM_t *acm)
 {
   int rc;
-  int txByteCount;
-  uint8_t *head;
-  size_t usedSpace;
+  int txByteCount = 0;
+  int writeCount;
+  ZephyrRingBufSegment_t segments[2];
 
-  usedSpace = ring_buf_size_get(&acm->txRingBuf) -
-    ring_buf_space_get(&acm->txRingBuf);
-  usedSpace = ring_buf_get_claim(&acm->txRingBuf, &head, usedSpace);
+  zephyrRingBufClaimGettingSegments(&acm->txRingBuf, segments,
+    zephyrRingBufGetUsedSpace(&acm->txRingBuf));
 
-  txByteCount = uart_fifo_fill(acm->dev, head, usedSpace);
-  if(txByteCount < 0)
+  /* the second segment is only written if the fifo took all the first one. */
+  for(uint8_t i = 0; i < 2 && segments[i].size > 0; ++i)
   {
-    LOG_ERR("unable to write to the fifo");
-    txByteCount = 0;
+    writeCount = uart_fifo_fill(acm->dev, segments[i].data, segments[i].size);
+    if(writeCount < 0)
+    {
+      LOG_ERR("unable to write to the fifo");
+      break;
+    }
+
+    txByteCount += writeCount;
+    if((size_t)writeCount < segments[i].size)
+      break;
   }
 
-  rc = ring_buf_get_finish(&acm->txRingBuf, txByteCount);
+  rc = zephyrRingBufFinishGetting(&acm->txRingBuf, txByteCount);
   if(rc < 0)
   {
     LOG_ERR("unable to transfer data from ring buffer to fifo");
@@ -166,13 +181,13 @@ int zephyrAcmWriteFifo(ZephyrACM_t *acm)
 int zephyrAcmReadRingBuffer(ZephyrACM_t *acm, uint8_t *dataBuf,
                             size_t dataBufSize)
 {
-  return ring_buf_get(&acm->rxRingBuf, dataBuf, dataBufSize);
+  return zephyrRingBufGet(&acm->rxRingBuf, dataBuf, dataBufSize);
 }
 
 int zephyrAcmWriteRingBuffer(ZephyrACM_t *acm, uint8_t *dataBuf,
                              size_t dataBufSize)
 {
-  return ring_buf_put(&acm->txRingBuf, dataBuf, dataBufSize);
+  return zephyrRingBufPut(&acm->txRingBuf, dataBuf, dataBufSize);
 }
 
 /** @} */
@@ -18,7 +18,8 @@
 #include <zephyr/device.h>
 #include <zephyr/kernel.h>
 #include <zephyr/drivers/uart.h>
-#include <zephyr/sys/ring_buffer.h>
+
+#include "zephyrRingBuffer.h"
 
 /**
  * @brief   The ACM data struct.
@@ -26,9 +27,9 @@
 typedef struct
 {
   const struct device *dev;                 /**< The ACM device. */
-  struct ring_buf rxRingBuf;                /**< The ACM Rx ring buffer. */
+  ZephyrRingBuffer_t rxRingBuf;             /**< The ACM Rx ring buffer. */
   uint8_t *rxBuffer;                        /**< The ACM Rx buffer. */
-  struct ring_buf txRingBuf;                /**< The ACM Tx ring buffer. */
+  ZephyrRingBuffer_t txRingBuf;             /**< The ACM Tx ring buffer. */
   uint8_t *txBuffer;                        /**< The ACM Tx buffer. */
   uart_irq_callback_user_data_t cb;         /**< The ACM interrupt callback. */
 } ZephyrACM_t;